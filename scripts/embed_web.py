@@ -0,0 +1,108 @@
+"""
+Embeds the dashboard (web/) into the firmware as gzip-compressed byte arrays.
+
+Runs as a PlatformIO pre-build script (extra_scripts = pre:scripts/embed_web.py)
+or standalone: python3 scripts/embed_web.py
+
+Output: src/web_assets.h (committed, so builds without this step still work).
+The header is only rewritten when its content changes, so unchanged assets do
+not trigger a rebuild.
+"""
+
+import gzip
+import hashlib
+import os
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+WEB_DIR = os.path.join(ROOT, "web")
+OUT = os.path.join(ROOT, "src", "web_assets.h")
+
+# path, file, mime, cache policy. The page revalidates (cheap 304); the assets it
+# references carry their content hash in the URL, so they can be cached for a year.
+ASSETS = [
+    ("/app.css", "app.css", "text/css", "public, max-age=31536000, immutable"),
+    ("/app.js", "app.js", "application/javascript", "public, max-age=31536000, immutable"),
+    ("/", "index.html", "text/html", "no-cache"),
+]
+
+
+def content_hash(data):
+    return hashlib.sha1(data).hexdigest()[:8]
+
+
+def c_array(name, data):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append("    " + ", ".join("0x%02X" % b for b in data[i:i + 16]) + ",")
+    return "static const uint8_t %s[] = {\n%s\n};\n" % (name, "\n".join(lines))
+
+
+def build():
+    hashes = {}
+    arrays = []
+    entries = []
+    for path, name, mime, cache in ASSETS:
+        with open(os.path.join(WEB_DIR, name), "rb") as f:
+            raw = f.read()
+        # index.html references the other assets by content hash
+        for key, value in hashes.items():
+            raw = raw.replace(("{{%s}}" % key).encode(), value.encode())
+
+        etag = content_hash(raw)
+        hashes["APP_%s_HASH" % name.split(".")[-1].upper()] = etag
+        packed = gzip.compress(raw, compresslevel=9, mtime=0)   # mtime=0: reproducible output
+
+        ident = "ASSET_" + name.upper().replace(".", "_")
+        arrays.append(c_array(ident, packed))
+        entries.append('    { "%s", "%s", "\\"%s\\"", "%s", %s, sizeof(%s) },   // %d -> %d B'
+                       % (path, mime, etag, cache, ident, ident, len(raw), len(packed)))
+
+    return """/*
+ * ======================================================================================
+ * FILE: web_assets.h
+ * DESCRIPTION: GENERATED by scripts/embed_web.py from web/. Do not edit by hand.
+ *              Gzip-compressed dashboard assets; const data stays in flash.
+ * ======================================================================================
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+struct WebAsset {
+    const char* path;
+    const char* mime;
+    const char* etag;            // Quoted content hash
+    const char* cacheControl;
+    const uint8_t* data;         // gzip
+    size_t len;
+};
+
+%s
+static const WebAsset WEB_ASSETS[] = {
+%s
+};
+
+static const size_t WEB_ASSET_COUNT = sizeof(WEB_ASSETS) / sizeof(WEB_ASSETS[0]);
+""" % ("\n".join(arrays), "\n".join(entries))
+
+
+def main():
+    text = build()
+    old = None
+    if os.path.exists(OUT):
+        with open(OUT, "r") as f:
+            old = f.read()
+    if text != old:
+        with open(OUT, "w") as f:
+            f.write(text)
+        print("[embed_web] Regenerated %s" % os.path.relpath(OUT, ROOT))
+
+
+try:
+    Import("env")  # noqa: F821 (PlatformIO)
+    main()
+except NameError:
+    if __name__ == "__main__":
+        main()
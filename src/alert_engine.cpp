@@ -0,0 +1,324 @@
+/*
+ * ======================================================================================
+ * FILE: alert_engine.cpp
+ * DESCRIPTION: Alert rules and their evaluation. Runs inside the AttackCore task at a
+ *              fixed ALERT_TICK_MS cadence; readers only see the published snapshot.
+ * ======================================================================================
+ */
+
+#include "alert_engine.h"
+#include "attacks.h"
+#include "survey.h"
+#include "rf_timeline.h"
+#include "event_store.h"
+#include "hardware.h"
+#include "bus.h"
+#include <Arduino.h>
+#include <cstdio>
+
+// --- RULES ---
+// hold/clear ticks x ALERT_TICK_MS: deauth opens after 1 s above 20/s, closes after 3 s below 5/s
+static const AlertRule RULES[] = {
+    { "deauth_rate",  "DEAUTH FLOOD", "/s", METRIC_DEAUTH_RATE,  AlertKind::THRESHOLD,
+      ALERT_DEAUTH_RAISE, ALERT_DEAUTH_CLEAR, 2, 6,  ALERT_COOLDOWN_MS },
+    { "channel_util", "CHANNEL BUSY", "%",  METRIC_CHANNEL_UTIL, AlertKind::THRESHOLD,
+      ALERT_UTIL_RAISE,   ALERT_UTIL_CLEAR,   4, 10, ALERT_COOLDOWN_MS },
+    { "rogue_ap",     "ROGUE AP",     "",   METRIC_ROGUE_AP,     AlertKind::RATE,
+      ALERT_ROGUE_RAISE,  ALERT_ROGUE_CLEAR,  1, 2,  ALERT_COOLDOWN_MS },
+    { "ble_flood",    "BLE FLOOD",    "/s", METRIC_BLE_FLOOD,    AlertKind::THRESHOLD,
+      ALERT_BLE_RAISE,    ALERT_BLE_CLEAR,    2, 6,  ALERT_COOLDOWN_MS },
+};
+
+static constexpr size_t RULE_COUNT = sizeof(RULES) / sizeof(RULES[0]);
+static_assert(RULE_COUNT <= ALERT_MAX_RULES, "[CFG-CRITICAL] More alert rules than ALERT_MAX_RULES.");
+
+// Window span in ms (rate normalisation)
+static constexpr uint32_t WINDOW_MS = (uint32_t)ALERT_WINDOW_TICKS * ALERT_TICK_MS;
+
+static inline uint16_t sat16(uint32_t v) { return (v > 0xFFFF) ? 0xFFFF : (uint16_t)v; }
+
+uint32_t AlertEngine::DeauthTrack::total() const {
+    uint32_t sum = 0;
+    for (int i = 0; i < ALERT_WINDOW_TICKS; i++) sum += bins[i];
+    return sum;
+}
+
+// --- LIFECYCLE ---
+
+AlertEngine& AlertEngine::getInstance() {
+    static AlertEngine instance;
+    return instance;
+}
+
+AlertEngine::AlertEngine() : lastTick(0), activeMask(0), ledPhase(false) {
+    memset(lastCounter, 0, sizeof(lastCounter));
+    reset();
+}
+
+// Counter baselines are kept: a reset must not replay old matches as new
+void AlertEngine::reset() {
+    memset(deauth, 0, sizeof(deauth));
+    deauthUsed = 0;
+    bin = 0;
+    memset(rateBins, 0, sizeof(rateBins));
+    memset(states, 0, sizeof(states));
+    memset(samples, 0, sizeof(samples));
+    activeMask = 0;
+    snapshot.write([](AlertSnapshot& s) {
+        s.activeMask = 0;
+        memset(s.values, 0, sizeof(s.values));
+    });
+}
+
+size_t AlertEngine::ruleCount() {
+    return RULE_COUNT;
+}
+
+const AlertRule& AlertEngine::rule(size_t index) {
+    return RULES[(index < RULE_COUNT) ? index : 0];
+}
+
+// --- INPUTS ---
+
+void AlertEngine::onDeauth(const uint8_t* bssid) {
+    if (!bssid) return;
+    DeauthTrack* t = nullptr;
+    for (size_t i = 0; i < deauthUsed; i++) {
+        if (memcmp(deauth[i].bssid, bssid, 6) == 0) {
+            t = &deauth[i];
+            break;
+        }
+    }
+    if (!t) {
+        if (deauthUsed < ALERT_DEAUTH_SLOTS) {
+            t = &deauth[deauthUsed++];
+        } else {
+            // Full: evict the quietest track (a spray of random BSSIDs cannot hide the busy one)
+            t = &deauth[0];
+            uint32_t low = t->total();
+            for (size_t i = 1; i < deauthUsed; i++) {
+                uint32_t v = deauth[i].total();
+                if (v < low) {
+                    low = v;
+                    t = &deauth[i];
+                }
+            }
+        }
+        memset(t, 0, sizeof(*t));
+        memcpy(t->bssid, bssid, 6);
+    }
+    if (t->bins[bin] < 0xFFFF) t->bins[bin]++;
+}
+
+void AlertEngine::pushCounter(AlertMetric m, uint32_t counter) {
+    uint32_t delta = counter - lastCounter[m];
+    lastCounter[m] = counter;
+    rateBins[m][bin] = sat16((uint32_t)rateBins[m][bin] + delta);
+}
+
+uint16_t AlertEngine::windowSum(AlertMetric m) const {
+    uint32_t sum = 0;
+    for (int i = 0; i < ALERT_WINDOW_TICKS; i++) sum += rateBins[m][i];
+    return sat16(sum);
+}
+
+// Gauges are read from the detectors' own published state; nothing here blocks
+void AlertEngine::sample(uint32_t now) {
+    (void)now;
+    memset(samples, 0, sizeof(samples));
+
+    // Deauth + disassoc rate of the busiest BSSID over the window
+    uint32_t busiest = 0;
+    for (size_t i = 0; i < deauthUsed; i++) {
+        uint32_t v = deauth[i].total();
+        if (v > busiest) {
+            busiest = v;
+            memcpy(samples[METRIC_DEAUTH_RATE].bssid, deauth[i].bssid, 6);
+        }
+    }
+    samples[METRIC_DEAUTH_RATE].value = sat16(busiest * 1000 / WINDOW_MS);
+
+    // Channel utilisation: latest closed RF slot, ignored once stale (RF_CORRELATE stopped)
+    RfSlot slot;
+    if (RfTimeline::getInstance().getLatest(slot) &&
+        RfTimeline::clockMs() - (slot.startMs + slot.durationMs) < 2 * RF_SLOT_MS) {
+        for (int k = 0; k < RF_WIFI_CHANNELS; k++) {
+            if (slot.ch[k].energy > samples[METRIC_CHANNEL_UTIL].value) {
+                samples[METRIC_CHANNEL_UTIL].value = slot.ch[k].energy;
+                samples[METRIC_CHANNEL_UTIL].ch = (uint8_t)(k + 1);
+            }
+        }
+    }
+
+    // Rogue APs: counter, the RATE rule sums its increase over the window
+    uint8_t ch = 0;
+    pushCounter(METRIC_ROGUE_AP, SiteSurvey::getInstance().getRogueMatches(samples[METRIC_ROGUE_AP].bssid, &ch));
+    samples[METRIC_ROGUE_AP].ch = ch;
+
+    // BLE flood score: decayed advert rate of the busiest vendor pattern
+    EngineStatus st;
+    if (AttackEngine::getInstance().getStatus(st) && st.attack == AttackType::BLE_DETECT && st.bleTop.key != 0) {
+        samples[METRIC_BLE_FLOOD].value = st.bleTop.rate;
+    }
+}
+
+// --- EVALUATION ---
+
+void AlertEngine::tick(uint32_t now) {
+    if (now - lastTick < ALERT_TICK_MS) return;
+    // Fixed cadence; after a long stall, restart from now instead of catching up
+    lastTick = (now - lastTick < 2 * ALERT_TICK_MS) ? lastTick + ALERT_TICK_MS : now;
+
+    sample(now);
+    evaluate(now);
+    driveLeds();
+
+    // Advance the window: the bin about to be reused starts empty
+    bin = (uint8_t)((bin + 1) % ALERT_WINDOW_TICKS);
+    for (int m = 0; m < METRIC_COUNT; m++) rateBins[m][bin] = 0;
+    for (size_t i = 0; i < deauthUsed;) {
+        deauth[i].bins[bin] = 0;
+        if (deauth[i].total() == 0) deauth[i] = deauth[--deauthUsed];   // Quiet: free the slot
+        else i++;
+    }
+}
+
+void AlertEngine::evaluate(uint32_t now) {
+    uint16_t values[ALERT_MAX_RULES] = {0};
+
+    for (size_t i = 0; i < RULE_COUNT; i++) {
+        const AlertRule& r = RULES[i];
+        RuleState& s = states[i];
+        uint16_t v = (r.kind == AlertKind::RATE) ? windowSum(r.metric) : samples[r.metric].value;
+        values[i] = v;
+
+        if (s.state == AlertState::ACTIVE) {
+            if (v > s.peak) s.peak = v;
+            if (v >= r.clear) {
+                s.streak = 0;
+            } else if (++s.streak >= r.clearTicks) {
+                s.state = AlertState::IDLE;
+                s.streak = 0;
+                activeMask &= (uint8_t)~(1u << i);
+                emit(i, false, v, now);
+            }
+            continue;
+        }
+
+        // IDLE / PENDING: the condition must hold for holdTicks consecutive ticks
+        if (v < r.raise) {
+            s.state = AlertState::IDLE;
+            s.streak = 0;
+            continue;
+        }
+        s.state = AlertState::PENDING;
+        if (s.streak < 0xFF) s.streak++;
+        if (s.streak < r.holdTicks) continue;
+
+        if (s.openedAt != 0 && now - s.openedAt < r.cooldownMs) {
+            // Stays pending and opens when the cooldown ends; counted once per episode
+            if (s.streak == r.holdTicks) {
+                snapshot.write([](AlertSnapshot& snap) { snap.suppressed++; });
+            }
+            continue;
+        }
+
+        s.state = AlertState::ACTIVE;
+        s.streak = 0;
+        s.peak = v;
+        s.openedAt = now ? now : 1;
+        activeMask |= (uint8_t)(1u << i);
+        emit(i, true, v, now);
+    }
+
+    uint8_t mask = activeMask;
+    snapshot.write([&](AlertSnapshot& snap) {
+        memcpy(snap.values, values, sizeof(snap.values));
+        snap.activeMask = mask;
+    });
+}
+
+// --- OUTPUTS ---
+
+void AlertEngine::emit(size_t index, bool raised, uint16_t value, uint32_t now) {
+    const AlertRule& r = RULES[index];
+    const Sample& detail = samples[r.metric];
+
+    AlertRecord rec;
+    memset(&rec, 0, sizeof(rec));
+    rec.at = now;
+    rec.value = value;
+    rec.peak = states[index].peak;
+    rec.rule = (uint8_t)index;
+    rec.raised = raised ? 1 : 0;
+    rec.ch = detail.ch;
+    memcpy(rec.bssid, detail.bssid, 6);
+
+    snapshot.write([&](AlertSnapshot& snap) {
+        rec.id = ++snap.lastId;
+        snap.history[snap.head] = rec;
+        snap.head = (uint16_t)((snap.head + 1) % ALERT_HISTORY);
+        if (snap.count < ALERT_HISTORY) snap.count++;
+    });
+
+    EvtAlert evt;
+    evt.rule = rec.rule;
+    evt.raised = rec.raised;
+    evt.value = rec.value;
+    evt.peak = rec.peak;
+    evt.ch = rec.ch;
+    memcpy(evt.bssid, rec.bssid, 6);
+    EventStore::post(EVT_ALERT, &evt, sizeof(evt));
+
+    if (raised) {
+        // OLED banner (UI task); dropped if the UI queue is full, the LED still blinks
+        Command cmd(CommandId::ALERT, (uint8_t)index);
+        snprintf(cmd.text, sizeof(cmd.text), "%s %u%s", r.name, (unsigned)value, r.unit);
+        MessageBus::getInstance().post(Subsystem::UI, cmd);
+    }
+
+    if (ENABLE_SERIAL_LOG) {
+        Serial.printf("[ALERT] %s %s value=%u peak=%u\n", r.key, raised ? "OPEN" : "CLOSED",
+                      (unsigned)value, (unsigned)rec.peak);
+    }
+}
+
+// Red LED blinks at the tick rate while any alert is open; runLoop() holds it
+// steady for a running attack only when nothing is open.
+void AlertEngine::driveLeds() {
+    if (activeMask) {
+        ledPhase = !ledPhase;
+        Hardware::getInstance().setLed(ledPhase);
+    } else if (ledPhase) {
+        ledPhase = false;
+        Hardware::getInstance().setLed(false);
+    }
+}
+
+// {"id":n,"age":ms,"rule":"<key>","name":"<banner>","open":true|false,"value":v,"peak":p[,"ch":c][,"bssid":"..."]}
+size_t AlertEngine::formatJson(const AlertRecord& r, uint32_t now, char* out, size_t cap) {
+    if (!out || cap == 0) return 0;
+    const AlertRule& rl = rule(r.rule);
+    int n = snprintf(out, cap, "{\"id\":%lu,\"age\":%lu,\"rule\":\"%s\",\"name\":\"%s\",\"open\":%s,\"value\":%u,\"peak\":%u",
+                     (unsigned long)r.id, (unsigned long)(now - r.at), rl.key, rl.name,
+                     r.raised ? "true" : "false", (unsigned)r.value, (unsigned)r.peak);
+    if (n < 0 || (size_t)n >= cap) return 0;
+
+    int m = 0;
+    if (r.ch) {
+        m = snprintf(out + n, cap - n, ",\"ch\":%u", (unsigned)r.ch);
+        if (m < 0 || (size_t)m >= cap - n) return 0;
+        n += m;
+    }
+    static const uint8_t ZERO[6] = {0};
+    if (memcmp(r.bssid, ZERO, 6) != 0) {
+        m = snprintf(out + n, cap - n, ",\"bssid\":\"%02X:%02X:%02X:%02X:%02X:%02X\"",
+                     r.bssid[0], r.bssid[1], r.bssid[2], r.bssid[3], r.bssid[4], r.bssid[5]);
+        if (m < 0 || (size_t)m >= cap - n) return 0;
+        n += m;
+    }
+    if ((size_t)n + 1 >= cap) return 0;
+    out[n++] = '}';
+    out[n] = '\0';
+    return (size_t)n;
+}
@@ -0,0 +1,137 @@
+/*
+ * ======================================================================================
+ * FILE: alert_engine.h
+ * DESCRIPTION: Rule-based incident detection over windowed detector metrics.
+ *              Threshold and rate rules with hysteresis, hold times and cooldowns,
+ *              evaluated at a fixed tick in the AttackCore task.
+ * ======================================================================================
+ */
+
+#pragma once
+
+#include "config.h"
+#include "seqlock.h"
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+enum AlertMetric : uint8_t {
+    METRIC_DEAUTH_RATE,      // Deauth + disassoc frames/s, busiest BSSID (gauge)
+    METRIC_CHANNEL_UTIL,     // NRF24 carrier occupancy %, busiest WiFi channel (gauge)
+    METRIC_ROGUE_AP,         // Beacons from BSSIDs cloning a known SSID (counter)
+    METRIC_BLE_FLOOD,        // Decayed advert rate of the busiest vendor pattern (gauge)
+    METRIC_COUNT
+};
+
+enum class AlertKind : uint8_t {
+    THRESHOLD,               // Current value
+    RATE                     // Counter increase over the sliding window
+};
+
+// raise/clear in metric units; clear < raise gives hysteresis
+struct AlertRule {
+    const char* key;         // JSON / event log
+    const char* name;        // OLED banner (max 12 chars)
+    const char* unit;        // Banner suffix
+    AlertMetric metric;
+    AlertKind   kind;
+    uint16_t    raise;
+    uint16_t    clear;
+    uint8_t     holdTicks;   // Consecutive ticks above `raise` before the alert opens
+    uint8_t     clearTicks;  // Consecutive ticks below `clear` before it closes
+    uint32_t    cooldownMs;  // Min time between two openings of the same rule
+};
+
+enum class AlertState : uint8_t { IDLE, PENDING, ACTIVE };
+
+// One transition (open or close)
+struct AlertRecord {
+    uint32_t id;             // Monotonic, 1-based (cursor for /api/alerts?since=)
+    uint32_t at;             // millis()
+    uint16_t value;          // Metric value at the transition
+    uint16_t peak;           // Highest value while open (close records)
+    uint8_t  rule;
+    uint8_t  raised;         // 1 = opened, 0 = closed
+    uint8_t  ch;             // Detail: channel (0 = n/a)
+    uint8_t  bssid[6];       // Detail: BSSID (zero = n/a)
+};
+
+struct AlertSnapshot {
+    AlertRecord history[ALERT_HISTORY];
+    uint16_t head;           // Next write slot
+    uint16_t count;
+    uint32_t lastId;
+    uint32_t suppressed;     // Openings swallowed by a cooldown
+    uint8_t  activeMask;     // Bit r = rule r open
+    uint16_t values[ALERT_MAX_RULES];   // Last evaluated value per rule
+
+    AlertSnapshot() : head(0), count(0), lastId(0), suppressed(0), activeMask(0) {
+        memset(history, 0, sizeof(history));
+        memset(values, 0, sizeof(values));
+    }
+};
+
+class AlertEngine {
+public:
+    static AlertEngine& getInstance();
+    AlertEngine(const AlertEngine&) = delete;
+    void operator=(const AlertEngine&) = delete;
+
+    // AttackCore task only
+    void onDeauth(const uint8_t* bssid);   // Per-BSSID sliding window
+    void tick(uint32_t now);                // Evaluates every ALERT_TICK_MS
+    void reset();
+
+    // Any task (lock-free snapshot)
+    bool getSnapshot(AlertSnapshot& out) const { return snapshot.load(out); }
+    bool anyActive() const { return activeMask != 0; }
+
+    static size_t ruleCount();
+    static const AlertRule& rule(size_t index);
+    static size_t formatJson(const AlertRecord& r, uint32_t now, char* out, size_t cap);
+
+private:
+    AlertEngine();
+
+    struct DeauthTrack {
+        uint8_t  bssid[6];
+        uint16_t bins[ALERT_WINDOW_TICKS];
+        uint32_t total() const;
+    };
+
+    struct RuleState {
+        AlertState state;
+        uint8_t  streak;     // Ticks the pending condition has held
+        uint16_t peak;
+        uint32_t openedAt;   // 0 = never
+    };
+
+    // Sampled each tick: gauge value + detail of the worst offender
+    struct Sample {
+        uint16_t value;
+        uint8_t  ch;
+        uint8_t  bssid[6];
+    };
+
+    DeauthTrack deauth[ALERT_DEAUTH_SLOTS];
+    size_t   deauthUsed;
+    uint8_t  bin;                                   // Current window bin
+
+    uint16_t rateBins[METRIC_COUNT][ALERT_WINDOW_TICKS];   // Counter metrics: increase per tick
+    uint32_t lastCounter[METRIC_COUNT];
+
+    RuleState states[ALERT_MAX_RULES];
+    Sample    samples[METRIC_COUNT];
+    uint32_t  lastTick;
+    volatile uint8_t activeMask;
+    bool      ledPhase;
+
+    SeqLock<AlertSnapshot> snapshot;
+
+    void sample(uint32_t now);
+    void pushCounter(AlertMetric m, uint32_t counter);
+    uint16_t windowSum(AlertMetric m) const;
+    void evaluate(uint32_t now);
+    void emit(size_t rule, bool raised, uint16_t value, uint32_t now);
+    void driveLeds();
+};
@@ -7,6 +7,10 @@
 
 #include "attacks.h"
 #include "hardware.h" 
+#include "survey.h"
+#include "rf_timeline.h"
+#include "event_store.h"
+#include "alert_engine.h"
 #include "esp_wifi.h"
 #include <BLEDevice.h>
 #include <BLEUtils.h>
@@ -14,9 +18,28 @@
 #include <BLEAdvertising.h>
 #include <freertos/task.h>
 
+// [Deterministic] BLE record queue lives in .bss (no heap after startup)
+static uint8_t bleQueueStore[BLE_QUEUE_LEN * sizeof(BleAdvRecord)];
+static StaticQueue_t bleQueueCtl;
+
 // Deterministic Channel Map (North America / Europe / Most of World)
 const uint8_t AttackEngine::VALID_CHANNELS[13] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13};
 
+// Frame classes each passive mode needs from the radio.
+// Modes not listed get the sniffer disabled: nothing reaches snifferCallback.
+struct SnifferProfile {
+    AttackType mode;
+    uint32_t filterMask;      // WIFI_PROMIS_FILTER_MASK_*
+    uint32_t ctrlMask;        // WIFI_PROMIS_CTRL_FILTER_MASK_* (only if CTRL requested)
+};
+
+static const SnifferProfile SNIFFER_PROFILES[] = {
+    { AttackType::PROBE_SNIFF,   WIFI_PROMIS_FILTER_MASK_MGMT, 0 },
+    { AttackType::DEAUTH_DETECT, WIFI_PROMIS_FILTER_MASK_MGMT, 0 },
+    { AttackType::SITE_SURVEY,   WIFI_PROMIS_FILTER_MASK_MGMT, 0 },
+    { AttackType::RF_CORRELATE,  WIFI_PROMIS_FILTER_MASK_MGMT | WIFI_PROMIS_FILTER_MASK_DATA, 0 },
+};
+
 AttackEngine* AttackEngine::instance = nullptr;
 
 AttackEngine& AttackEngine::getInstance() {
@@ -29,17 +52,19 @@ AttackEngine::AttackEngine()
     : currentAttack(AttackType::NONE), 
       active(false), 
       targetCh(1),
-      handshakeCount(0),
-      probeCount(0),
-      deauthCounter(0)
+      deauthCounter(0),
+      snifferCalls(0),
+      bleDropped(0),
+      channelPinned(false)
 {
     // [Safety] Mutex for shared resources (Config, Logs)
     mutex = xSemaphoreCreateMutex();
     
     // [Safety] Queue for passing data from ISR to Task context securely
-    packetQueue = xQueueCreate(20, sizeof(PacketMsg));
+    packetQueue = xQueueCreate(PACKET_QUEUE_LEN, sizeof(PacketMsg));
+    bleQueue = xQueueCreateStatic(BLE_QUEUE_LEN, sizeof(BleAdvRecord), bleQueueStore, &bleQueueCtl);
     
-    if (mutex == NULL || packetQueue == NULL) {
+    if (mutex == NULL || packetQueue == NULL || bleQueue == NULL) {
         if (ENABLE_SERIAL_LOG) Serial.println("[CRITICAL] RTOS Objects Init Failed!");
     }
 
@@ -56,13 +81,16 @@ AttackEngine::AttackEngine()
 }
 
 void AttackEngine::init() {
+    if (!frame_view_check::run() && ENABLE_SERIAL_LOG) Serial.println("[ENGINE-ERR] FrameView self-check failed!");
+
     WiFi.mode(WIFI_STA);
     WiFi.disconnect();
     
-    esp_wifi_set_promiscuous(true);
     esp_wifi_set_promiscuous_rx_cb(&AttackEngine::snifferCallback);
+    applySnifferFilter(AttackType::NONE);
     
     BLEDevice::init("LEVIATHAN");
+    BLEDevice::setCustomGapHandler(&AttackEngine::bleGapHandler);
 }
 
 void AttackEngine::setTarget(const uint8_t (&bssid)[6], int channel) {
@@ -79,6 +107,9 @@ void AttackEngine::setAttack(AttackType type) {
         if(currentAttack >= AttackType::BLE_SOUR && currentAttack <= AttackType::BLE_GOOGLE) {
             stopBLE();
         }
+        if (currentAttack == AttackType::BLE_DETECT) {
+            stopBleScan();
+        }
         
         currentAttack = type;
         active = (type != AttackType::NONE);
@@ -91,10 +122,23 @@ void AttackEngine::setAttack(AttackType type) {
             else if (type == AttackType::BLE_GOOGLE) bleType = 3;
             startBLE(bleType);
         }
+        if (type == AttackType::BLE_DETECT) {
+            bleGuard.reset();
+            bleDropped = 0;
+            xQueueReset(bleQueue);
+            startBleScan();
+        }
+        if (type == AttackType::RF_CORRELATE) {
+            RfTimeline::getInstance().reset();
+        }
+        
+        // [Performance] Radio-side filtering for the new mode
+        applySnifferFilter(type);
         
         // Reset Queues/Counters on mode switch
         xQueueReset(packetQueue);
         
+        publishStatus();
         xSemaphoreGive(mutex);
     }
 }
@@ -106,6 +150,30 @@ void AttackEngine::stopAttack() {
     Hardware::getInstance().getRadio().startListening();
 }
 
+// Executes bus commands in the AttackCore task (callers never block on radio work)
+void AttackEngine::handleCommand(const Command& cmd) {
+    switch (cmd.id) {
+        case CommandId::SET_ATTACK:
+            setAttack((AttackType)cmd.arg);
+            break;
+        case CommandId::STOP_ATTACK:
+            stopAttack();
+            break;
+        case CommandId::SET_TARGET:
+            setTarget(cmd.bssid, cmd.channel);
+            break;
+        case CommandId::SCAN:
+            runScan(cmd);
+            break;
+        case CommandId::CLEAR_LOGS:
+            clearLogs();
+            AlertEngine::getInstance().reset();
+            break;
+        default:
+            break;
+    }
+}
+
 bool AttackEngine::isAttacking() const { return active; }
 AttackType AttackEngine::getCurrentAttackType() const { return currentAttack; }
 
@@ -116,13 +184,21 @@ size_t AttackEngine::scanNetworks(APInfo* buffer, size_t maxCount) {
 
     // [Performance] Blocking scan. In a real OS this should be async, 
     // but for this architecture we block briefly.
-    WiFi.mode(WIFI_STA);
-    WiFi.disconnect();
+    // A web AP (C2 / Evil Twin) may be serving the request that asked for this sweep:
+    // scan as AP+STA so the softAP and its clients stay up (the driver returns to the
+    // AP channel between scan channels). Only a plain station is reset.
+    if (WiFi.getMode() & WIFI_MODE_AP) {
+        if (WiFi.getMode() != WIFI_AP_STA) WiFi.mode(WIFI_AP_STA);
+    } else {
+        WiFi.mode(WIFI_STA);
+        WiFi.disconnect();
+    }
     
     int n = WiFi.scanNetworks(false, false, false, 100); 
     if (n < 0) return 0; // Error
 
     size_t count = 0;
+    uint32_t now = millis();
     for(int i=0; i<n && count < maxCount; i++) {
         APInfo ap;
         ap.setSSID(WiFi.SSID(i)); 
@@ -130,6 +206,9 @@ size_t AttackEngine::scanNetworks(APInfo* buffer, size_t maxCount) {
         ap.rssi = WiFi.RSSI(i);
         ap.ch = WiFi.channel(i);
         
+        // [Survey] Every sweep is a sample, weak APs included (coverage edge)
+        SiteSurvey::getInstance().record(ap.ssid, ap.bssid, ap.ch, ap.rssi, now);
+        
         // [Sanity] Filter noise
         if (ap.rssi > MIN_RSSI_THRESHOLD && ap.isSSIDMeaningful()) {
             buffer[count++] = ap; 
@@ -138,65 +217,109 @@ size_t AttackEngine::scanNetworks(APInfo* buffer, size_t maxCount) {
     return count;
 }
 
-size_t AttackEngine::getHandshakes(AttackLog* buffer, size_t maxCount) {
-    if (xSemaphoreTake(mutex, 10)) {
-        size_t toCopy = (handshakeCount < maxCount) ? handshakeCount : maxCount;
-        for(size_t i=0; i<toCopy; i++) {
-            buffer[i] = handshakeLogs[i];
-        }
-        xSemaphoreGive(mutex);
-        return toCopy;
+// Blocking sweep, then publish to the shared cache and notify the requester.
+// Requests queued behind a sweep that finished after they were posted are
+// answered from the cache instead of sweeping again.
+void AttackEngine::runScan(const Command& cmd) {
+    auto& cache = ScanCache::getInstance();
+    size_t n;
+    if (cache.completedSince(cmd.postedAt)) {
+        n = cache.count();
+    } else {
+        static APInfo sweep[MAX_SCAN_RESULTS];
+        n = scanNetworks(sweep, MAX_SCAN_RESULTS);
+        cache.publish(sweep, n);
+    }
+
+    if (cmd.replyTo != Subsystem::COUNT) {
+        Command done(CommandId::SCAN_DONE, (uint8_t)((n > 255) ? 255 : n));
+        MessageBus::getInstance().post(cmd.replyTo, done);
     }
-    return 0;
 }
 
-size_t AttackEngine::getProbes(AttackLog* buffer, size_t maxCount) {
-    if (xSemaphoreTake(mutex, 10)) {
-        size_t toCopy = (probeCount < maxCount) ? probeCount : maxCount;
-        for(size_t i=0; i<toCopy; i++) {
-            buffer[i] = probeLogs[i];
-        }
-        xSemaphoreGive(mutex);
-        return toCopy;
+size_t AttackEngine::readRing(const SeqLock<LogRing>& ring, AttackLog* buffer, size_t maxCount) {
+    if (!buffer || maxCount == 0) return 0;
+    size_t copied = 0;
+    if (!ring.read([&](const LogRing& r) { copied = r.copyTo(buffer, maxCount); })) {
+        return 0; // Writer kept racing: caller keeps its previous view
     }
-    return 0;
+    return copied;
+}
+
+size_t AttackEngine::getHandshakes(AttackLog* buffer, size_t maxCount) const {
+    return readRing(handshakeLog, buffer, maxCount);
+}
+
+size_t AttackEngine::getProbes(AttackLog* buffer, size_t maxCount) const {
+    return readRing(probeLog, buffer, maxCount);
+}
+
+size_t AttackEngine::getAlerts(AttackLog* buffer, size_t maxCount) const {
+    return readRing(alertLog, buffer, maxCount);
+}
+
+bool AttackEngine::getLastAlert(AttackLog& out) const {
+    bool found = false;
+    bool ok = alertLog.read([&](const LogRing& r) {
+        const AttackLog* last = r.newest();
+        found = (last != nullptr);
+        if (found) out = *last;
+    });
+    return ok && found;
+}
+
+bool AttackEngine::getStatus(EngineStatus& out) const {
+    return status.load(out);
 }
 
 int AttackEngine::getDeauthCount() { return deauthCounter; }
+uint32_t AttackEngine::getSpoofCount() const { return deauthGuard.getSpoofCount(); }
 
 void AttackEngine::clearLogs() {
     if (xSemaphoreTake(mutex, portMAX_DELAY)) {
-        handshakeCount = 0;
-        probeCount = 0;
+        handshakeLog.write([](LogRing& r) { r.clear(); });
+        probeLog.write([](LogRing& r) { r.clear(); });
+        alertLog.write([](LogRing& r) { r.clear(); });
         deauthCounter = 0;
+        deauthGuard.reset();
+        bleGuard.reset();
+        publishStatus();
         xSemaphoreGive(mutex);
     }
 }
 
 // --- INTERNAL HELPERS ---
 
+// Log writers: caller holds `mutex` (writer serialisation, O(1) append)
 void AttackEngine::logHandshake(const char* msg) {
-    if (handshakeCount < MAX_LOGS) {
-        handshakeLogs[handshakeCount++].set(msg);
-    } else {
-        
-        for(size_t i=0; i < MAX_LOGS - 1; i++) {
-            handshakeLogs[i] = handshakeLogs[i+1];
-        }
-     
-        handshakeLogs[MAX_LOGS - 1].set(msg);
-    }
+    handshakeLog.write([&](LogRing& r) { r.push(msg); });
 }
 
 void AttackEngine::logProbe(const char* mac) {
-    if (probeCount < MAX_LOGS) {
-        probeLogs[probeCount++].set(mac);
-    } else {
-        for(size_t i=0; i < MAX_LOGS - 1; i++) {
-            probeLogs[i] = probeLogs[i+1];
-        }
-        probeLogs[MAX_LOGS - 1].set(mac);
-    }
+    probeLog.write([&](LogRing& r) { r.push(mac); });
+}
+
+void AttackEngine::logAlert(const char* msg) {
+    alertLog.write([&](LogRing& r) { r.push(msg); });
+}
+
+// Caller holds `mutex`
+void AttackEngine::publishStatus() {
+    EngineStatus s;
+    s.attack = currentAttack;
+    s.active = active;
+    s.deauthFrames = deauthCounter;
+    s.spoofedFrames = deauthGuard.getSpoofCount();
+    s.snifferCalls = snifferCalls;
+    s.bleAdverts = bleGuard.getAdvertCount();
+    s.bleFloods = bleGuard.getFloodCount();
+    s.bleDropped = bleDropped;
+    if (!bleGuard.getTop(s.bleTop, millis())) s.bleTop.key = 0;
+    handshakeLog.read([&](const LogRing& r) { s.handshakes = r.count; });
+    probeLog.read([&](const LogRing& r) { s.probes = r.count; });
+    alertLog.read([&](const LogRing& r) { s.alerts = r.count; });
+    s.updatedAt = millis();
+    status.store(s);
 }
 
 // --- CORE LOGIC & ISR ---
@@ -204,57 +327,69 @@ void AttackEngine::logProbe(const char* mac) {
 void AttackEngine::runLoop() {
     if(!active) return;
     
-    // 1. Process Packet Queue (From ISR)
+    // 1. Process Packet Queue (From ISR) and BLE adverts (From GAP callback)
     processPacketQueue();
+    processBleQueue();
 
-    // 2. Handle Attack Logic
+    // 2. Snapshot config + publish status under the lock; radio work and
+    //    sleeps below run outside the critical section.
+    AttackType mode;
+    uint8_t bssid[6];
+    int ch;
     if (xSemaphoreTake(mutex, 10)) {
+        mode = currentAttack;
+        memcpy(bssid, targetBSSID, 6);
+        ch = targetCh;
+        publishStatus();
+        xSemaphoreGive(mutex);
+    } else {
+        taskYIELD();
+        return;
+    }
+
+    // 3. Handle Attack Logic
+    // Steady while attacking; AlertEngine blinks it while an alert is open
+    if (!AlertEngine::getInstance().anyActive()) Hardware::getInstance().setLed(true);
+
+    switch(mode) {
+        case AttackType::DEAUTH_TARGET:
+            sendDeauth(bssid, ch);
+            break;
+            
+        case AttackType::BEACON_LIST:
+            sendBeacons(true);
+            break;
+            
+        case AttackType::BEACON_RANDOM:
+            sendBeacons(false);
+            break;
+            
+        case AttackType::PROBE_SNIFF:
+        case AttackType::SITE_SURVEY:
+            hopChannel();
+            break;
+
+        case AttackType::RF_CORRELATE:
+            // [Performance] ~1 ms of NRF24 sampling per pass; the task delay leaves the rest
+            RfTimeline::getInstance().tick();
+            hopChannel();
+            break;
+
+        case AttackType::DEAUTH_DETECT:
+        case AttackType::BLE_DETECT:
+            // [Performance] Queue is drained every pass; the task loop paces us
+            break;
         
-        Hardware::getInstance().setLed(true); 
-
-        switch(currentAttack) {
-            case AttackType::DEAUTH_TARGET:
-                sendDeauth();
-                break;
-                
-            case AttackType::BEACON_LIST:
-                sendBeacons(true);
-                break;
-                
-            case AttackType::BEACON_RANDOM:
-                sendBeacons(false);
-                break;
-                
-            case AttackType::PROBE_SNIFF:
-            {
-                static uint8_t chIdx = 0;
-                static unsigned long lastHop = 0;
-                
-                if (millis() - lastHop > CHANNEL_HOP_DELAY) {
-                    chIdx = (chIdx + 1) % 13;
-                    int nextCh = VALID_CHANNELS[chIdx];
-                    if (nextCh >= 1 && nextCh <= 13) {
-                        esp_wifi_set_channel(nextCh, WIFI_SECOND_CHAN_NONE);
-                    }
-                    lastHop = millis();
-                }
-            }
+        case AttackType::RF_JAM:
+            static int jamCh = 0;
+            Hardware::getInstance().jamFreq(jamCh++);
+            if(jamCh > 80) jamCh = 0;
+            vTaskDelay(JAMMER_HOP_SPEED / portTICK_PERIOD_MS);
             break;
             
-            case AttackType::RF_JAM:
-                static int jamCh = 0;
-                Hardware::getInstance().jamFreq(jamCh++);
-                if(jamCh > 80) jamCh = 0;
-                vTaskDelay(JAMMER_HOP_SPEED / portTICK_PERIOD_MS);
-                break;
-                
-            default:
-                vTaskDelay(100 / portTICK_PERIOD_MS);
-                break;
-        }
-        xSemaphoreGive(mutex);
-    } else {
-         taskYIELD();
+        default:
+            vTaskDelay(100 / portTICK_PERIOD_MS);
+            break;
     }
 }
 
@@ -262,63 +397,235 @@ void AttackEngine::runLoop() {
 void AttackEngine::processPacketQueue() {
     PacketMsg msg;
     int processed = 0;
-    while(xQueueReceive(packetQueue, &msg, 0) == pdTRUE && processed < 5) {
+    while(processed < PACKET_BATCH_LIMIT && xQueueReceive(packetQueue, &msg, 0) == pdTRUE) {
         processed++;
         
-        if (msg.type == 1) {    
+        if (msg.type == PKT_BEACON || msg.type == PKT_DEAUTH) {
+            inspectManagement(msg);
+        }
+        else if (msg.type == PKT_SURVEY) {
+            recordSurvey(msg);
+        }
+        else if (msg.type == PKT_PROBE) {    
              char macStr[18];
              snprintf(macStr, sizeof(macStr), "%02X:%02X:%02X:%02X:%02X:%02X",
-                msg.payload[10], msg.payload[11], msg.payload[12], 
-                msg.payload[13], msg.payload[14], msg.payload[15]);
+                msg.src[0], msg.src[1], msg.src[2], 
+                msg.src[3], msg.src[4], msg.src[5]);
              
-             logProbe(macStr);
+             if (xSemaphoreTake(mutex, 10)) {
+                 logProbe(macStr);
+                 xSemaphoreGive(mutex);
+             }
+        }
+    }
+}
+
+// Drains the whole BLE queue: records are small and the table update is
+// O(BLE_PROBE_LIMIT), so one pass keeps up with a dense advertising burst.
+void AttackEngine::processBleQueue() {
+    BleAdvRecord rec;
+    uint32_t now = millis();
+    while (xQueueReceive(bleQueue, &rec, 0) == pdTRUE) {
+        if (bleGuard.onAdvert(rec, now) != BleVerdict::FLOOD) continue;
+        if (!bleGuard.shouldAlert(rec.patternKey)) continue;
+
+        BlePattern p;
+        if (!bleGuard.getPattern(rec.patternKey, p)) continue;
+        char buf[48];
+        snprintf(buf, sizeof(buf), "FLOOD %s %04X r%u a%u",
+            BleFloodGuard::vendorName(p.vendor, p.flags), p.vendor,
+            (unsigned)p.rate, (unsigned)p.addresses());
+        if (xSemaphoreTake(mutex, 10)) {
+            logAlert(buf);
+            xSemaphoreGive(mutex);
+        }
+        EvtBleFlood evt = { p.vendor, p.flags, (uint8_t)((p.rate > 255) ? 255 : p.rate),
+                            (uint8_t)p.addresses(), rec.rssi };
+        EventStore::post(EVT_BLE_FLOOD, &evt, sizeof(evt));
+        if (ENABLE_SERIAL_LOG) Serial.printf("[BLE-GUARD] %s (rssi %d)\n", buf, rec.rssi);
+    }
+}
+
+void AttackEngine::applySnifferFilter(AttackType type) {
+    const SnifferProfile* profile = nullptr;
+    for (const auto& p : SNIFFER_PROFILES) {
+        if (p.mode == type) { profile = &p; break; }
+    }
+
+    if (!profile) {
+        esp_wifi_set_promiscuous(false);
+        return;
+    }
+
+    wifi_promiscuous_filter_t filter = { .filter_mask = profile->filterMask };
+    esp_wifi_set_promiscuous_filter(&filter);
+
+    if (profile->filterMask & WIFI_PROMIS_FILTER_MASK_CTRL) {
+        wifi_promiscuous_filter_t ctrl = { .filter_mask = profile->ctrlMask };
+        esp_wifi_set_promiscuous_ctrl_filter(&ctrl);
+    }
+
+    esp_wifi_set_promiscuous(true);
+}
+
+void AttackEngine::hopChannel() {
+    static uint8_t chIdx = 0;
+    static unsigned long lastHop = 0;
+    
+    // Retuning would drag the web AP along and drop its clients
+    if (channelPinned) return;
+
+    if (millis() - lastHop > CHANNEL_HOP_DELAY) {
+        chIdx = (chIdx + 1) % 13;
+        int nextCh = VALID_CHANNELS[chIdx];
+        if (nextCh >= 1 && nextCh <= 13) {
+            esp_wifi_set_channel(nextCh, WIFI_SECOND_CHAN_NONE);
+        }
+        lastHop = millis();
+    }
+}
+
+// Beacon / Probe Response -> per-AP RSSI statistics
+void AttackEngine::recordSurvey(const PacketMsg& msg) {
+    // SSID IE already located and length-checked by classifyFrame
+    if (msg.ssidLen > sizeof(msg.ssid)) return;
+
+    char ssid[33];
+    memcpy(ssid, msg.ssid, msg.ssidLen);
+    ssid[msg.ssidLen] = '\0';
+
+    SiteSurvey::getInstance().record(ssid, msg.bssid, msg.channel, msg.rssi, millis(), msg.security);
+}
+
+// Feeds the spoofed-deauth guard: beacons train, deauth/disassoc get classified
+void AttackEngine::inspectManagement(const PacketMsg& msg) {
+    const uint8_t* src   = msg.src;
+    const uint8_t* bssid = msg.bssid;
+    uint16_t seq = msg.seq;
+
+    if (msg.type == PKT_BEACON) {
+        deauthGuard.onBeacon(bssid, seq, msg.rssi, millis());
+        return;
+    }
+
+    AlertEngine::getInstance().onDeauth(bssid);
+    GuardVerdict v = deauthGuard.onDeauth(src, bssid, seq, msg.rssi);
+    if ((v == GuardVerdict::SPOOF_SEQ || v == GuardVerdict::SPOOF_RSSI) && deauthGuard.shouldAlert(bssid)) {
+        char buf[48];
+        snprintf(buf, sizeof(buf), "SPOOF %s %02X:%02X:%02X:%02X:%02X:%02X",
+            (v == GuardVerdict::SPOOF_SEQ) ? "SEQ" : "RSSI",
+            bssid[0], bssid[1], bssid[2], bssid[3], bssid[4], bssid[5]);
+        if (xSemaphoreTake(mutex, 10)) {
+            logAlert(buf);
+            xSemaphoreGive(mutex);
         }
+        EvtDeauthSpoof evt;
+        memcpy(evt.bssid, bssid, 6);
+        evt.why = (v == GuardVerdict::SPOOF_SEQ) ? 0 : 1;
+        evt.rssi = (int8_t)msg.rssi;
+        EventStore::post(EVT_DEAUTH_SPOOF, &evt, sizeof(evt));
+        if (ENABLE_SERIAL_LOG) Serial.printf("[GUARD] %s (rssi %d, seq %u)\n", buf, msg.rssi, seq);
     }
 }
 
+// Radio buffer as a FrameView: sig_len counts the trailing FCS, the view must not
+static inline FrameView rxFrame(const wifi_promiscuous_pkt_t* p) {
+    size_t sigLen = p->rx_ctrl.sig_len;
+    return FrameView(p->payload, (sigLen > DOT11_FCS) ? sigLen - DOT11_FCS : 0);
+}
+
+// Pure frame classification: (mode, raw frame) -> queue record.
+// Parsed in place (FrameView, bounded by sig_len minus FCS); only the fields the
+// task needs are copied out. Shared by the sniffer and the on-device benchmark.
+bool AttackEngine::classifyFrame(AttackType mode, const wifi_promiscuous_pkt_t* p, PacketMsg& msg) {
+    FrameView frame = rxFrame(p);
+    if (!frame.hasMgmtHeader()) return false;   // Addresses + sequence control present
+    FrameControl fc = frame.fc();
+
+    switch (mode) {
+        // 1. Deauth Detection: Beacon/Deauth MAC headers only
+        case AttackType::DEAUTH_DETECT:
+            if (fc.isDeauthOrDisassoc()) msg.type = PKT_DEAUTH;
+            else if (fc.isMgmt(MGMT_BEACON)) msg.type = PKT_BEACON;
+            else return false;
+            msg.ssidLen = 0;
+            msg.security = 0;
+            break;
+
+        // 2. Site Survey: Beacon / Probe Response incl. SSID IE
+        case AttackType::SITE_SURVEY: {
+            if (!(fc.isMgmt(MGMT_BEACON) || fc.isMgmt(MGMT_PROBE_RESP))) return false;
+            InfoElement ssid = frame.element(IE_SSID);
+            if (!ssid.present() || ssid.len > sizeof(msg.ssid)) return false;
+            msg.type = PKT_SURVEY;
+            msg.ssidLen = ssid.len;
+            memcpy(msg.ssid, ssid.data, ssid.len);
+            msg.security = frame.securityMask();
+            break;
+        }
+
+        // 3. Probe Request
+        case AttackType::PROBE_SNIFF:
+            if (!fc.isMgmt(MGMT_PROBE_REQ)) return false;
+            msg.type = PKT_PROBE;
+            msg.ssidLen = 0;
+            msg.security = 0;
+            break;
+
+        default:
+            return false;
+    }
+
+    msg.channel = p->rx_ctrl.channel;
+    msg.rssi = (int8_t)p->rx_ctrl.rssi;
+    msg.seq = frame.seq();
+    memcpy(msg.src, frame.addr2(), 6);
+    memcpy(msg.bssid, frame.addr3(), 6);
+    return true;
+}
+
 void AttackEngine::snifferCallback(void* buf, wifi_promiscuous_pkt_type_t type) {
     if(!instance) return;
     
+    instance->snifferCalls++;
+    
     wifi_promiscuous_pkt_t *p = (wifi_promiscuous_pkt_t*)buf;
-    if (p->rx_ctrl.sig_len < 16) return;
+    AttackType mode = instance->currentAttack;
 
-    // 1. Deauth Detection (Atomic Counter - Safe)
-    if(instance->currentAttack == AttackType::DEAUTH_DETECT) {
-        if (p->payload[0] == 0xC0 || p->payload[0] == 0xA0) {
-            instance->deauthCounter++;
-        }
+    // Timeline only needs per-channel frame counts (MGMT + DATA)
+    if (mode == AttackType::RF_CORRELATE) {
+        RfTimeline::onFrame(p->rx_ctrl.channel);
         return;
     }
 
-    // 2. Probe Request -> Queue
-    if(instance->currentAttack == AttackType::PROBE_SNIFF) {
-        if (p->payload[0] == 0x40 && p->rx_ctrl.sig_len > 26) {
-             PacketMsg msg;
-             msg.type = 1; // Probe
-             msg.len = (p->rx_ctrl.sig_len < sizeof(msg.payload)) ? p->rx_ctrl.sig_len : sizeof(msg.payload);
-             msg.rssi = p->rx_ctrl.rssi;
-             
-             memcpy(msg.payload, p->payload, msg.len);
-            
-             BaseType_t xHigherPriorityTaskWoken = pdFALSE;
-             if (xQueueSendFromISR(instance->packetQueue, &msg, &xHigherPriorityTaskWoken) == pdTRUE) {
-                 portYIELD_FROM_ISR();
-             }
-        }
+    // [Performance] Hardware filter already drops the rest; this is a cheap backstop
+    if (type != WIFI_PKT_MGMT) return;
+
+    // Deauth Detection (Atomic Counter - Safe)
+    if (mode == AttackType::DEAUTH_DETECT && rxFrame(p).fc().isDeauthOrDisassoc()) {
+        instance->deauthCounter++;
+    }
+
+    PacketMsg msg;
+    if (!classifyFrame(mode, p, msg)) return;
+
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+    if (xQueueSendFromISR(instance->packetQueue, &msg, &xHigherPriorityTaskWoken) == pdTRUE) {
+        portYIELD_FROM_ISR();
     }
 }
 
 // --- ATTACK HELPERS ---
 
-void AttackEngine::buildDeauthPacket() {
+void AttackEngine::buildDeauthPacket(const uint8_t (&bssid)[6]) {
     memcpy(&deauthPacket[4], "\xFF\xFF\xFF\xFF\xFF\xFF", 6); 
-    memcpy(&deauthPacket[10], targetBSSID, 6);
-    memcpy(&deauthPacket[16], targetBSSID, 6);
+    memcpy(&deauthPacket[10], bssid, 6);
+    memcpy(&deauthPacket[16], bssid, 6);
 }
 
-void AttackEngine::sendDeauth() {
-    buildDeauthPacket();
-    esp_wifi_set_channel(targetCh, WIFI_SECOND_CHAN_NONE);
+void AttackEngine::sendDeauth(const uint8_t (&bssid)[6], int channel) {
+    buildDeauthPacket(bssid);
+    esp_wifi_set_channel(channel, WIFI_SECOND_CHAN_NONE);
     for(int i=0; i<DEAUTH_BURST_SIZE; i++) {
         esp_wifi_80211_tx(WIFI_IF_STA, deauthPacket, 26, false);
         vTaskDelay(DEAUTH_PACKET_DELAY / portTICK_PERIOD_MS); 
@@ -354,6 +661,44 @@ void AttackEngine::startBLE(int type) {
 void AttackEngine::stopBLE() {
     BLEDevice::getAdvertising()->stop();
 }
+
+// Passive, continuous, duplicates kept: every advert reaches bleGapHandler.
+// Scanning starts once the controller acknowledges the parameters.
+void AttackEngine::startBleScan() {
+    static esp_ble_scan_params_t params;
+    params.scan_type = BLE_SCAN_TYPE_PASSIVE;
+    params.own_addr_type = BLE_ADDR_TYPE_PUBLIC;
+    params.scan_filter_policy = BLE_SCAN_FILTER_ALLOW_ALL;
+    params.scan_interval = BLE_SCAN_INTERVAL;
+    params.scan_window = BLE_SCAN_INTERVAL;
+    params.scan_duplicate = BLE_SCAN_DUPLICATE_DISABLE;
+    esp_ble_gap_set_scan_params(&params);
+}
+
+void AttackEngine::stopBleScan() {
+    esp_ble_gap_stop_scanning();
+}
+
+void AttackEngine::bleGapHandler(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t* param) {
+    if (!instance || instance->currentAttack != AttackType::BLE_DETECT) return;
+
+    if (event == ESP_GAP_BLE_SCAN_PARAM_SET_COMPLETE_EVT) {
+        esp_ble_gap_start_scanning(0); // 0 = until stopped
+        return;
+    }
+    if (event != ESP_GAP_BLE_SCAN_RESULT_EVT || param->scan_rst.search_evt != ESP_GAP_SEARCH_INQ_RES_EVT) return;
+
+    // [Performance] Parse + hash here, hand the task a 16-byte record
+    BleAdvRecord rec;
+    size_t len = param->scan_rst.adv_data_len + param->scan_rst.scan_rsp_len;
+    if (len > sizeof(param->scan_rst.ble_adv)) len = sizeof(param->scan_rst.ble_adv);
+    if (!BleFloodGuard::parseAdvert(param->scan_rst.bda, param->scan_rst.ble_addr_type != BLE_ADDR_TYPE_PUBLIC,
+                                    param->scan_rst.ble_adv, len, param->scan_rst.rssi, rec)) return;
+
+    if (xQueueSend(instance->bleQueue, &rec, 0) != pdTRUE) {
+        instance->bleDropped++;
+    }
+}
 extern "C" {
     
     int ieee80211_raw_frame_sanity_check(void* frame, int len) {
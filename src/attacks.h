@@ -9,7 +9,14 @@
 
 #include "config.h"
 #include "types.h" 
+#include "deauth_guard.h"
+#include "ble_guard.h"
+#include "seqlock.h"
+#include "bus.h"
+#include "scan_cache.h"
+#include "frame_view.h"
 #include <WiFi.h>
+#include <esp_gap_ble_api.h>
 #include <freertos/semphr.h>
 #include <freertos/queue.h> 
 #include <cstdint> 
@@ -24,14 +31,80 @@ struct AttackLog {
     }
 };
 
+// Fixed ring of log lines (O(1) append, oldest overwritten)
+struct LogRing {
+    AttackLog entries[MAX_LOGS];
+    uint16_t head;    // Next write slot
+    uint16_t count;
 
+    LogRing() : head(0), count(0) {}
+
+    void push(const char* msg) {
+        entries[head].set(msg);
+        head = (head + 1) % MAX_LOGS;
+        if (count < MAX_LOGS) count++;
+    }
+
+    void clear() { head = 0; count = 0; }
+
+    // Copies the newest `maxCount` lines, oldest first
+    size_t copyTo(AttackLog* out, size_t maxCount) const {
+        size_t n = (count < maxCount) ? count : maxCount;
+        size_t start = (head + MAX_LOGS - n) % MAX_LOGS;
+        for (size_t i = 0; i < n; i++) out[i] = entries[(start + i) % MAX_LOGS];
+        return n;
+    }
+
+    const AttackLog* newest() const {
+        return count ? &entries[(head + MAX_LOGS - 1) % MAX_LOGS] : nullptr;
+    }
+};
+
+// Engine state published to UI/Web readers (lock-free snapshot)
+struct EngineStatus {
+    AttackType attack;
+    bool active;
+    int deauthFrames;
+    uint32_t spoofedFrames;
+    uint32_t snifferCalls;
+    uint16_t handshakes;
+    uint16_t probes;
+    uint16_t alerts;
+    uint32_t bleAdverts;
+    uint32_t bleFloods;       // Adverts flagged as part of a flood
+    uint32_t bleDropped;      // GAP callback queue full
+    BlePattern bleTop;        // Highest-rate pattern (key 0 = none)
+    uint32_t updatedAt;
+
+    EngineStatus() : attack(AttackType::NONE), active(false), deauthFrames(0), spoofedFrames(0),
+                     snifferCalls(0), handshakes(0), probes(0), alerts(0), bleAdverts(0),
+                     bleFloods(0), bleDropped(0), updatedAt(0) { memset(&bleTop, 0, sizeof(bleTop)); }
+};
+
+// PacketMsg.type discriminator (Sniffer -> Task)
+enum PacketKind : uint8_t {
+    PKT_PROBE  = 1,
+    PKT_BEACON = 2,
+    PKT_DEAUTH = 3,   // Deauth or Disassoc
+    PKT_SURVEY = 4    // Beacon/Probe Response incl. SSID IE
+};
+
+// Fields parsed in the sniffer callback (FrameView over the radio buffer);
+// the queue carries these, not raw frame bytes.
 struct PacketMsg {
     uint8_t type;         
-    uint8_t payload[36]; 
-    size_t len;
-    int rssi;
+    uint8_t channel;
+    int8_t  rssi;
+    uint8_t ssidLen;      // PKT_SURVEY
+    uint16_t seq;         // Sequence number (12 bit)
+    uint8_t src[6];       // Addr2 (transmitter)
+    uint8_t bssid[6];     // Addr3
+    char    ssid[32];     // PKT_SURVEY, not terminated
+    uint16_t security;    // PKT_SURVEY, SecurityBits (rogue-AP fingerprint)
 };
 
+static_assert(sizeof(PacketMsg) == 52, "[MEM] PacketMsg must stay padding-free (copied per queued frame).");
+
 class AttackEngine {
 public:
     static AttackEngine& getInstance();
@@ -49,15 +122,25 @@ public:
     
     // Configuration
     void setTarget(const uint8_t (&bssid)[6], int channel);
+    // Web AP up (NetCore): no channel hopping, the softAP follows the radio's channel
+    void pinChannel(bool pinned) { channelPinned = pinned; }
+    
+    // Bus entry point (AttackCore task only)
+    void handleCommand(const Command& cmd);
     
     // Data Access (Deterministic / Zero-Allocation)
-    size_t scanNetworks(APInfo* buffer, size_t maxCount);
+    size_t scanNetworks(APInfo* buffer, size_t maxCount);   // Sweep results are published to ScanCache
     
-    // Log Accessors - Populates external buffer
-    size_t getHandshakes(AttackLog* buffer, size_t maxCount);
-    size_t getProbes(AttackLog* buffer, size_t maxCount);
+    // Log Accessors - Populates external buffer (lock-free, never blocks)
+    size_t getHandshakes(AttackLog* buffer, size_t maxCount) const;
+    size_t getProbes(AttackLog* buffer, size_t maxCount) const;
+    size_t getAlerts(AttackLog* buffer, size_t maxCount) const;
+    bool getLastAlert(AttackLog& out) const;
+    bool getStatus(EngineStatus& out) const;
     
     int getDeauthCount();
+    uint32_t getSpoofCount() const;
+    uint32_t getSnifferCalls() const { return snifferCalls; }
     void clearLogs(); 
     
     // Core Logic (Called by FreeRTOS Task)
@@ -65,13 +148,20 @@ public:
     
     // Sniffer Callback (Static ISR Context)
     static void snifferCallback(void* buf, wifi_promiscuous_pkt_type_t type);
+    static bool classifyFrame(AttackType mode, const wifi_promiscuous_pkt_t* p, PacketMsg& msg);
+    
+    // BLE GAP Callback (Bluedroid task context)
+    static void bleGapHandler(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t* param);
 
 private:
     AttackEngine(); 
     
     // Concurrency & Safety
+    // `mutex` serialises writers (config + snapshot publication) for short,
+    // non-sleeping sections only. Readers go through the SeqLocks below.
     SemaphoreHandle_t mutex;
     QueueHandle_t packetQueue; 
+    QueueHandle_t bleQueue;       // Static storage, BleAdvRecord
     
     // State
     AttackType currentAttack;
@@ -79,31 +169,46 @@ private:
     uint8_t targetBSSID[6];
     int targetCh;
     
-    AttackLog handshakeLogs[MAX_LOGS];
-    size_t handshakeCount;
-    
-    AttackLog probeLogs[MAX_LOGS];
-    size_t probeCount;
+    SeqLock<LogRing> handshakeLog;
+    SeqLock<LogRing> probeLog;
+    SeqLock<LogRing> alertLog;
+    SeqLock<EngineStatus> status;
     
     volatile int deauthCounter;
+    volatile uint32_t snifferCalls;
+    volatile uint32_t bleDropped;
+    volatile bool channelPinned;
+    DeauthGuard deauthGuard;
+    BleFloodGuard bleGuard;
     
     // Deterministic Channel Map
     static const uint8_t VALID_CHANNELS[13];
 
     // Internal Helpers
     void processPacketQueue();
+    void processBleQueue();
     void logHandshake(const char* msg);
     void logProbe(const char* mac);
+    void logAlert(const char* msg);
+    void publishStatus();
+    void runScan(const Command& cmd);
+    static size_t readRing(const SeqLock<LogRing>& ring, AttackLog* buffer, size_t maxCount);
+    void inspectManagement(const PacketMsg& msg);
+    void recordSurvey(const PacketMsg& msg);
+    void hopChannel();
+    void applySnifferFilter(AttackType type);
 
     // Internal Attack Vectors
-    void sendDeauth();
+    void sendDeauth(const uint8_t (&bssid)[6], int channel);
     void sendBeacons(bool rickroll);
     void startBLE(int type);
     void stopBLE();
+    void startBleScan();
+    void stopBleScan();
     
     // Packet construction
     uint8_t deauthPacket[26];
-    void buildDeauthPacket();
+    void buildDeauthPacket(const uint8_t (&bssid)[6]);
     
     static AttackEngine* instance; 
 };
@@ -0,0 +1,219 @@
+/*
+ * ======================================================================================
+ * FILE: benchmark.cpp
+ * DESCRIPTION: Benchmark runner. Static buffers only; synthetic inputs never touch
+ *              live engine/survey state.
+ * ======================================================================================
+ */
+
+#include "benchmark.h"
+#include "hardware.h"
+#include "attacks.h"
+#include "survey.h"
+#include "health.h"
+
+static const char* const CASE_NAMES[BENCH_CASES] = {
+    "OLED", "NRF", "NVSW", "NVSR", "SNIF", "JSON"
+};
+
+// Synthetic beacon: promiscuous header + 802.11 frame with SSID IE
+static const size_t BENCH_FRAME_LEN = 96;
+alignas(4) static uint8_t benchFrame[sizeof(wifi_promiscuous_pkt_t) + BENCH_FRAME_LEN];
+
+// Private consumer-side state so the sniffer case never pollutes real tables
+static DeauthGuard benchGuard;
+static StaticQueue_t benchQueueCtl;
+static uint8_t benchQueueStore[sizeof(PacketMsg)];
+
+static void buildSyntheticBeacon() {
+    memset(benchFrame, 0, sizeof(benchFrame));
+    wifi_promiscuous_pkt_t* p = (wifi_promiscuous_pkt_t*)benchFrame;
+    p->rx_ctrl.sig_len = BENCH_FRAME_LEN;
+    p->rx_ctrl.rssi = -60;
+    p->rx_ctrl.channel = 6;
+
+    uint8_t* f = p->payload;
+    const size_t ie = DOT11_MGMT_HDR + DOT11_BEACON_BODY;
+    f[DOT11_FC] = FrameControl::mgmtByte(MGMT_BEACON);
+    memset(&f[DOT11_ADDR1], 0xFF, 6);                   // DA broadcast
+    const uint8_t bssid[6] = {0x02, 0x4C, 0x56, 0x42, 0x4E, 0x43};
+    memcpy(&f[DOT11_ADDR2], bssid, 6);                  // SA
+    memcpy(&f[DOT11_ADDR3], bssid, 6);                  // BSSID
+    f[ie] = IE_SSID;
+    f[ie + 1] = 8;
+    memcpy(&f[ie + 2], "BENCH_AP", 8);
+}
+
+Benchmark& Benchmark::getInstance() {
+    static Benchmark instance;
+    return instance;
+}
+
+const char* Benchmark::caseName(uint8_t c) {
+    return (c < BENCH_CASES) ? CASE_NAMES[c] : "?";
+}
+
+// Max 4 chars so three values + name fit one 21-column OLED line
+void Benchmark::formatDuration(uint32_t ns, char* out, size_t cap) {
+    static const char UNITS[] = {'n', 'u', 'm', 's'};
+    uint32_t scale = 1;
+    int unit = 0;
+    while (unit < 3 && ns / scale >= 1000) {
+        scale *= 1000;
+        unit++;
+    }
+    uint32_t whole = ns / scale;
+    if (whole < 10 && unit > 0) {
+        snprintf(out, cap, "%lu.%lu%c", (unsigned long)whole, (unsigned long)((ns / (scale / 10)) % 10), UNITS[unit]);
+    } else {
+        snprintf(out, cap, "%lu%c", (unsigned long)whole, UNITS[unit]);
+    }
+}
+
+// Sorts the first `count` samples in place; nearest-rank percentiles
+BenchResult Benchmark::summarize(size_t count) {
+    BenchResult r;
+    memset(&r, 0, sizeof(r));
+    if (count == 0) return r;
+
+    for (size_t i = 1; i < count; i++) {
+        uint32_t v = samples[i];
+        size_t j = i;
+        while (j > 0 && samples[j - 1] > v) {
+            samples[j] = samples[j - 1];
+            j--;
+        }
+        samples[j] = v;
+    }
+
+    size_t p99 = (count * 99 + 99) / 100;
+    if (p99 > 0) p99--;
+    r.minNs = samples[0];
+    r.medianNs = samples[count / 2];
+    r.p99Ns = samples[(p99 < count) ? p99 : count - 1];
+    r.samples = (uint16_t)count;
+    return r;
+}
+
+void Benchmark::runAll(void (*progress)(const char* caseName)) {
+    auto& hw = Hardware::getInstance();
+    BenchReport next;
+    report.load(next);
+
+    // 1. OLED flush
+    if (progress) progress(CASE_NAMES[BENCH_OLED_FLUSH]);
+    for (size_t i = 0; i < BENCH_SAMPLES_OLED; i++) {
+        uint32_t t0 = micros();
+        hw.getDisplay().display();
+        samples[i] = (micros() - t0) * 1000UL;
+        HealthMonitor::getInstance().feed(HEALTH_UI);
+    }
+    next.results[BENCH_OLED_FLUSH] = summarize(BENCH_SAMPLES_OLED);
+
+    // 2. NRF24 sweep
+    if (progress) progress(CASE_NAMES[BENCH_NRF_SWEEP]);
+    uint8_t spectrum[128];
+    memset(spectrum, 0, sizeof(spectrum));
+    for (size_t i = 0; i < BENCH_SAMPLES_NRF; i++) {
+        uint32_t t0 = micros();
+        hw.scanSpectrum(spectrum);
+        samples[i] = (micros() - t0) * 1000UL;
+        HealthMonitor::getInstance().feed(HEALTH_UI);
+    }
+    next.results[BENCH_NRF_SWEEP] = summarize(BENCH_SAMPLES_NRF);
+
+    // 3. NVS write / read (dedicated key)
+    if (progress) progress(CASE_NAMES[BENCH_NVS_WRITE]);
+    for (size_t i = 0; i < BENCH_SAMPLES_NVS; i++) {
+        uint32_t t0 = micros();
+        hw.saveCounter("bench", (uint32_t)i);
+        samples[i] = (micros() - t0) * 1000UL;
+        HealthMonitor::getInstance().feed(HEALTH_UI);
+    }
+    next.results[BENCH_NVS_WRITE] = summarize(BENCH_SAMPLES_NVS);
+
+    if (progress) progress(CASE_NAMES[BENCH_NVS_READ]);
+    volatile uint32_t sink = 0;
+    for (size_t i = 0; i < BENCH_SAMPLES_NVS; i++) {
+        uint32_t t0 = micros();
+        sink += hw.loadCounter("bench");
+        samples[i] = (micros() - t0) * 1000UL;
+    }
+    next.results[BENCH_NVS_READ] = summarize(BENCH_SAMPLES_NVS);
+
+    // 4. Sniffer path at synthetic load (batched: one frame is below micros() resolution)
+    if (progress) progress(CASE_NAMES[BENCH_SNIFFER]);
+    static QueueHandle_t benchQueue = NULL;
+    if (benchQueue == NULL) {
+        benchQueue = xQueueCreateStatic(1, sizeof(PacketMsg), benchQueueStore, &benchQueueCtl);
+    }
+    buildSyntheticBeacon();
+    benchGuard.reset();
+    wifi_promiscuous_pkt_t* frame = (wifi_promiscuous_pkt_t*)benchFrame;
+    PacketMsg msg;
+    PacketMsg rx;
+    uint16_t seq = 0;
+    for (size_t i = 0; i < BENCH_SAMPLES_SNIFFER; i++) {
+        uint32_t t0 = micros();
+        for (size_t k = 0; k < BENCH_SNIFFER_BATCH; k++) {
+            frame->payload[DOT11_SEQ_CTRL] = (uint8_t)(seq << 4);
+            frame->payload[DOT11_SEQ_CTRL + 1] = (uint8_t)(seq >> 4);
+            seq = (seq + 1) & 0x0FFF;
+            AttackType mode = (k & 1) ? AttackType::SITE_SURVEY : AttackType::DEAUTH_DETECT;
+            if (AttackEngine::classifyFrame(mode, frame, msg)) {
+                xQueueSend(benchQueue, &msg, 0);
+                if (xQueueReceive(benchQueue, &rx, 0) == pdTRUE) {
+                    benchGuard.onBeacon(rx.bssid, rx.seq, rx.rssi, millis());
+                }
+            }
+        }
+        samples[i] = (micros() - t0) * 1000UL / BENCH_SNIFFER_BATCH;
+    }
+    HealthMonitor::getInstance().feed(HEALTH_UI);
+    next.results[BENCH_SNIFFER] = summarize(BENCH_SAMPLES_SNIFFER);
+
+    // 5. JSON serialisation of one survey record
+    if (progress) progress(CASE_NAMES[BENCH_JSON]);
+    SurveyRecord rec;
+    memset(&rec, 0, sizeof(rec));
+    safeStrCopy(rec.ssid, "BENCH_AP", sizeof(rec.ssid));
+    rec.ch = 6; rec.rssiMin = -80; rec.rssiMax = -40; rec.rssiLast = -55;
+    rec.ewma = -55 * 256; rec.var = 16 * 16; rec.samples = 1000;
+    rec.hist[8] = 40; rec.hist[10] = 200; rec.hist[12] = 20;
+    char json[320];
+    for (size_t i = 0; i < BENCH_SAMPLES_JSON; i++) {
+        uint32_t t0 = micros();
+        SiteSurvey::formatJson(rec, millis(), json, sizeof(json));
+        samples[i] = (micros() - t0) * 1000UL;
+    }
+    next.results[BENCH_JSON] = summarize(BENCH_SAMPLES_JSON);
+
+    next.completedAt = millis();
+    next.runs++;
+    report.store(next);
+
+    if (ENABLE_SERIAL_LOG) {
+        char line[512];
+        formatJson(line, sizeof(line));
+        Serial.print("[BENCH] ");
+        Serial.println(line);
+    }
+}
+
+size_t Benchmark::formatJson(char* out, size_t cap) const {
+    if (!out || cap == 0) return 0;
+    BenchReport r;
+    if (!report.load(r)) r = BenchReport();
+
+    int n = snprintf(out, cap, "{\"fw\":\"%s\",\"build\":\"%s %s\",\"runs\":%u,\"at\":%lu,\"cases\":[",
+                     FW_VERSION, __DATE__, __TIME__, (unsigned)r.runs, (unsigned long)r.completedAt);
+    for (uint8_t c = 0; c < BENCH_CASES && n > 0 && (size_t)n < cap; c++) {
+        const BenchResult& b = r.results[c];
+        n += snprintf(out + n, cap - n, "%s{\"name\":\"%s\",\"n\":%u,\"min_ns\":%lu,\"med_ns\":%lu,\"p99_ns\":%lu}",
+                      (c > 0) ? "," : "", CASE_NAMES[c], (unsigned)b.samples,
+                      (unsigned long)b.minNs, (unsigned long)b.medianNs, (unsigned long)b.p99Ns);
+    }
+    if (n > 0 && (size_t)n < cap) n += snprintf(out + n, cap - n, "]}");
+    if (n < 0) return 0;
+    return ((size_t)n < cap) ? (size_t)n : cap - 1;
+}
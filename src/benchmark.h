@@ -0,0 +1,68 @@
+/*
+ * ======================================================================================
+ * FILE: benchmark.h
+ * DESCRIPTION: On-device microbenchmark suite (TEST SUITE > BENCHMARK).
+ * ======================================================================================
+ */
+
+#pragma once
+
+#include "config.h"
+#include "seqlock.h"
+#include <cstdint>
+#include <cstring>
+
+enum BenchCase : uint8_t {
+    BENCH_OLED_FLUSH,     // Full SSD1306 framebuffer push (I2C)
+    BENCH_NRF_SWEEP,      // One 128-channel NRF24 carrier sweep
+    BENCH_NVS_WRITE,      // 32-bit NVS put
+    BENCH_NVS_READ,       // 32-bit NVS get
+    BENCH_SNIFFER,        // Per frame: classify -> queue -> dequeue -> guard
+    BENCH_JSON,           // One survey record serialisation
+    BENCH_CASES
+};
+
+// Nanoseconds so fast and slow cases share one unit
+struct BenchResult {
+    uint32_t minNs;
+    uint32_t medianNs;
+    uint32_t p99Ns;
+    uint16_t samples;
+};
+
+struct BenchReport {
+    BenchResult results[BENCH_CASES];
+    uint32_t completedAt;     // millis()
+    uint16_t runs;
+
+    BenchReport() : completedAt(0), runs(0) { memset(results, 0, sizeof(results)); }
+};
+
+class Benchmark {
+public:
+    static Benchmark& getInstance();
+    Benchmark(const Benchmark&) = delete;
+    void operator=(const Benchmark&) = delete;
+
+    // Blocking run on the calling task (feeds the task WDT between samples)
+    void runAll(void (*progress)(const char* caseName) = nullptr);
+
+    // Lock-free copy of the last completed run
+    bool getReport(BenchReport& out) const { return report.load(out); }
+
+    static const char* caseName(uint8_t c);
+
+    // "12m" / "8.5u" / "420n" (single-letter unit)
+    static void formatDuration(uint32_t ns, char* out, size_t cap);
+
+    // Telemetry: one JSON object with version, run count and all cases
+    size_t formatJson(char* out, size_t cap) const;
+
+private:
+    Benchmark() {}
+
+    uint32_t samples[BENCH_MAX_SAMPLES];
+    SeqLock<BenchReport> report;
+
+    BenchResult summarize(size_t count);
+};
@@ -0,0 +1,221 @@
+/*
+ * ======================================================================================
+ * FILE: ble_guard.cpp
+ * DESCRIPTION: Fixed-size counting table with lazy time decay. Integer-only, no allocation.
+ * ======================================================================================
+ */
+
+#include "ble_guard.h"
+#include <cstring>
+
+// 32-bit FNV-1a: cheap enough for the GAP callback, well spread in the low bits
+static const uint32_t FNV_OFFSET = 2166136261UL;
+static const uint32_t FNV_PRIME  = 16777619UL;
+
+static inline uint32_t fnv1a(uint32_t h, const uint8_t* p, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        h ^= p[i];
+        h *= FNV_PRIME;
+    }
+    return h;
+}
+
+static inline size_t homeSlot(uint32_t key) {
+    return (key ^ (key >> 16)) & (BLE_PATTERN_SLOTS - 1);
+}
+
+BleFloodGuard::BleFloodGuard() {
+    reset();
+}
+
+void BleFloodGuard::reset() {
+    memset(table, 0, sizeof(table));
+    memset(dedup, 0, sizeof(dedup));
+    dedupEpoch = 0;
+    used = 0;
+    adverts = 0;
+    duplicates = 0;
+    floods = 0;
+}
+
+bool BleFloodGuard::parseAdvert(const uint8_t* addr, bool randomAddr, const uint8_t* data, size_t len,
+                                int rssi, BleAdvRecord& out) {
+    if (!addr || !data || len < 2) return false;
+
+    // Walk the AD structures: [len][type][data...], bounds-checked
+    const uint8_t* mfg = nullptr;
+    size_t mfgLen = 0;
+    const uint8_t* svc = nullptr;
+    uint32_t layout = FNV_OFFSET;
+    size_t i = 0;
+    while (i + 1 < len) {
+        uint8_t adLen = data[i];
+        if (adLen == 0 || i + 1 + adLen > len) break;   // Padding or truncated structure
+        uint8_t adType = data[i + 1];
+        size_t n = adLen - 1;
+        layout = fnv1a(layout, &adType, 1);
+        if (adType == 0xFF && n >= 2 && !mfg) {
+            mfg = &data[i + 2];
+            mfgLen = n;
+        } else if ((adType == 0x16 || adType == 0x03) && n >= 2 && !svc) {
+            svc = &data[i + 2];
+        }
+        i += 1 + adLen;
+    }
+    if (layout == FNV_OFFSET) return false;
+
+    // Vendor pattern: company ID + leading sub-type bytes (Apple/Samsung/Microsoft
+    // spam varies the tail), or the 16-bit service UUID alone (Fast Pair varies
+    // the model ID right after it), or the AD layout as a last resort.
+    uint32_t key;
+    if (mfg) {
+        size_t take = (mfgLen < 2 + BLE_PATTERN_BYTES) ? mfgLen : 2 + BLE_PATTERN_BYTES;
+        out.vendor = (uint16_t)(mfg[0] | (mfg[1] << 8));
+        out.flags = BLE_SRC_COMPANY;
+        key = fnv1a(FNV_OFFSET ^ BLE_SRC_COMPANY, mfg, take);
+    } else if (svc) {
+        out.vendor = (uint16_t)(svc[0] | (svc[1] << 8));
+        out.flags = BLE_SRC_SERVICE;
+        key = fnv1a(FNV_OFFSET ^ BLE_SRC_SERVICE, svc, 2);
+    } else {
+        out.vendor = 0;
+        out.flags = BLE_SRC_LAYOUT;
+        key = layout;
+    }
+
+    uint32_t addrHash = fnv1a(FNV_OFFSET, addr, 6);
+    out.patternKey = key ? key : 1;
+    out.advHash = fnv1a(addrHash, data, len);
+    out.addrBit = (uint8_t)((addrHash ^ (addrHash >> 6)) & 63);
+    out.rssi = (int8_t)((rssi < -128) ? -128 : (rssi > 127) ? 127 : rssi);
+    if (randomAddr) out.flags |= BLE_ADDR_RANDOM;
+    return true;
+}
+
+void BleFloodGuard::decay(BlePattern& p, uint32_t epoch) {
+    uint32_t elapsed = epoch - p.epoch;
+    if (elapsed == 0) return;
+    p.rate = (elapsed >= 16) ? 0 : (uint16_t)(p.rate >> elapsed);
+    p.addrPrev = (elapsed == 1) ? p.addrCur : 0;
+    p.addrCur = 0;
+    if (p.rate == 0) p.flooded = 0;   // Burst over: the next one alerts again
+    p.epoch = epoch;
+}
+
+BlePattern* BleFloodGuard::lookup(uint32_t key, uint32_t epoch) {
+    // Linear probing; slots are recycled in place, never emptied, so the
+    // first empty slot ends the search.
+    size_t home = homeSlot(key);
+    BlePattern* victim = nullptr;
+    for (size_t i = 0; i < BLE_PROBE_LIMIT; i++) {
+        BlePattern& p = table[(home + i) & (BLE_PATTERN_SLOTS - 1)];
+        if (p.key == key) {
+            decay(p, epoch);
+            return &p;
+        }
+        if (p.key == 0) {
+            victim = &p;
+            used++;
+            break;
+        }
+        decay(p, epoch);
+        if (!victim || p.rate < victim->rate) victim = &p;
+    }
+
+    // [Bounded] Probe window full: recycle the quietest pattern
+    memset(victim, 0, sizeof(BlePattern));
+    victim->key = key;
+    victim->epoch = epoch;
+    return victim;
+}
+
+const BlePattern* BleFloodGuard::find(uint32_t key) const {
+    size_t home = homeSlot(key);
+    for (size_t i = 0; i < BLE_PROBE_LIMIT; i++) {
+        const BlePattern& p = table[(home + i) & (BLE_PATTERN_SLOTS - 1)];
+        if (p.key == key) return &p;
+        if (p.key == 0) break;
+    }
+    return nullptr;
+}
+
+BleVerdict BleFloodGuard::onAdvert(const BleAdvRecord& rec, uint32_t now) {
+    uint32_t epoch = now / BLE_DECAY_MS;
+    adverts++;
+
+    // 1. Duplicate suppression: a device repeating the same advert counts once per window
+    if (epoch != dedupEpoch) {
+        memset(dedup, 0, sizeof(dedup));
+        dedupEpoch = epoch;
+    }
+    uint32_t tag = rec.advHash | 1;   // 0 marks an empty filter cell
+    uint32_t& cell = dedup[(rec.advHash >> 8) & (BLE_DEDUP_SLOTS - 1)];
+    if (cell == tag) {
+        duplicates++;
+        return BleVerdict::DUPLICATE;
+    }
+    cell = tag;
+
+    // 2. Count against the vendor pattern
+    BlePattern* p = lookup(rec.patternKey, epoch);
+    if (p->rate < 0xFFFF) p->rate++;
+    p->addrCur |= (1ULL << rec.addrBit);
+    p->vendor = rec.vendor;
+    p->flags |= rec.flags;
+    p->rssi = rec.rssi;
+    p->lastSeen = now;
+
+    // 3. Burst of near-identical adverts from addresses that keep rotating.
+    //    Needs a previous window to compare against (a crowd seen for the
+    //    first time is all "new").
+    if (p->rate >= BLE_FLOOD_MIN_RATE && p->addrPrev != 0 && p->churn() >= BLE_FLOOD_MIN_CHURN) {
+        if (p->flooded < 0xFFFF) p->flooded++;
+        floods++;
+        return BleVerdict::FLOOD;
+    }
+    return BleVerdict::NORMAL;
+}
+
+bool BleFloodGuard::shouldAlert(uint32_t key) const {
+    const BlePattern* p = find(key);
+    if (!p || p->flooded == 0) return false;
+    return (p->flooded == 1) || (p->flooded % BLE_ALERT_EVERY == 0);
+}
+
+bool BleFloodGuard::getPattern(uint32_t key, BlePattern& out) const {
+    const BlePattern* p = find(key);
+    if (!p) return false;
+    out = *p;
+    return true;
+}
+
+bool BleFloodGuard::getTop(BlePattern& out, uint32_t now) const {
+    uint32_t epoch = now / BLE_DECAY_MS;
+    bool found = false;
+    for (size_t i = 0; i < BLE_PATTERN_SLOTS; i++) {
+        if (table[i].key == 0) continue;
+        BlePattern p = table[i];
+        decay(p, epoch);
+        if (!found || p.rate > out.rate) {
+            out = p;
+            found = true;
+        }
+    }
+    return found;
+}
+
+const char* BleFloodGuard::vendorName(uint16_t vendor, uint8_t flags) {
+    if (flags & BLE_SRC_COMPANY) {
+        switch (vendor) {
+            case 0x004C: return "Apple";
+            case 0x0075: return "Samsung";
+            case 0x0006: return "Microsoft";
+            case 0x00E0: return "Google";
+            default:     return "Vendor";
+        }
+    }
+    if (flags & BLE_SRC_SERVICE) {
+        return (vendor == 0xFE2C) ? "FastPair" : "Service";
+    }
+    return "Generic";
+}
@@ -0,0 +1,98 @@
+/*
+ * ======================================================================================
+ * FILE: ble_guard.h
+ * DESCRIPTION: BLE advertisement-flood detection via a decaying vendor-pattern table.
+ * ======================================================================================
+ */
+
+#pragma once
+
+#include "config.h"
+#include <cstdint>
+#include <cstddef>
+
+// Pattern source flags
+#define BLE_SRC_COMPANY   0x01    // Manufacturer Specific Data (AD 0xFF)
+#define BLE_SRC_SERVICE   0x02    // 16-bit Service Data / UUID (AD 0x16 / 0x03)
+#define BLE_SRC_LAYOUT    0x04    // Neither: AD type sequence only
+#define BLE_ADDR_RANDOM   0x80    // Advertiser used a random address
+
+// One parsed advertisement (GAP callback -> AttackCore task, 16 bytes)
+struct BleAdvRecord {
+    uint32_t patternKey;  // Vendor pattern hash (company/service + leading payload)
+    uint32_t advHash;     // Address + full payload (duplicate suppression)
+    uint16_t vendor;      // Company ID or 16-bit service UUID
+    int8_t   rssi;
+    uint8_t  flags;       // BLE_SRC_* | BLE_ADDR_RANDOM
+    uint8_t  addrBit;     // Address hash, 0..63 (rotation bitmap index)
+};
+
+// Counting-table slot (40 bytes). `rate` and the address windows decay lazily.
+struct BlePattern {
+    uint64_t addrCur;     // Address-hash bitmap, current decay window
+    uint64_t addrPrev;    // Address-hash bitmap, previous decay window
+    uint32_t key;         // 0 = empty slot
+    uint32_t epoch;       // Decay window of the last update (now / BLE_DECAY_MS)
+    uint32_t lastSeen;    // millis()
+    uint16_t vendor;
+    uint16_t rate;        // Unique adverts, halved every window
+    uint16_t flooded;     // Adverts flagged in the current burst (saturating)
+    int8_t   rssi;        // Last RSSI
+    uint8_t  flags;
+
+    // Distinct addresses over both windows (lower bound, hash collisions merge)
+    uint8_t addresses() const { return (uint8_t)__builtin_popcountll(addrCur | addrPrev); }
+
+    // Addresses this window that were absent last window: a stable crowd of
+    // devices scores ~0, a spammer rotating its address scores ~addresses()
+    uint8_t churn() const { return (uint8_t)__builtin_popcountll(addrCur & ~addrPrev); }
+};
+
+enum class BleVerdict : uint8_t {
+    DUPLICATE,    // Same address + payload already counted this window
+    NORMAL,
+    FLOOD         // Pattern exceeds rate and address-rotation thresholds
+};
+
+class BleFloodGuard {
+public:
+    BleFloodGuard();
+
+    void reset();
+
+    // Pure parser (GAP callback context). False if the advert carries nothing to key on.
+    static bool parseAdvert(const uint8_t* addr, bool randomAddr, const uint8_t* data, size_t len,
+                            int rssi, BleAdvRecord& out);
+
+    // Counting path (task context). O(BLE_PROBE_LIMIT), no allocation.
+    BleVerdict onAdvert(const BleAdvRecord& rec, uint32_t now);
+
+    // True when the last FLOOD verdict for this pattern should be surfaced to the log
+    bool shouldAlert(uint32_t key) const;
+
+    // Copy of one pattern as last updated. False if it is not tracked.
+    bool getPattern(uint32_t key, BlePattern& out) const;
+
+    // Highest-rate pattern (decayed to `now`). False if the table is empty.
+    bool getTop(BlePattern& out, uint32_t now) const;
+
+    uint32_t getAdvertCount() const { return adverts; }
+    uint32_t getDuplicateCount() const { return duplicates; }
+    uint32_t getFloodCount() const { return floods; }
+    size_t getTrackedCount() const { return used; }
+
+    static const char* vendorName(uint16_t vendor, uint8_t flags);
+
+private:
+    BlePattern table[BLE_PATTERN_SLOTS];
+    uint32_t dedup[BLE_DEDUP_SLOTS];  // Direct-mapped advHash filter, cleared per window
+    uint32_t dedupEpoch;
+    size_t used;
+    uint32_t adverts;
+    uint32_t duplicates;
+    uint32_t floods;
+
+    BlePattern* lookup(uint32_t key, uint32_t epoch);
+    const BlePattern* find(uint32_t key) const;
+    static void decay(BlePattern& p, uint32_t epoch);
+};
@@ -0,0 +1,111 @@
+/*
+ * ======================================================================================
+ * FILE: bus.cpp
+ * DESCRIPTION: Message bus over statically allocated FreeRTOS queues.
+ * ======================================================================================
+ */
+
+#include "bus.h"
+
+// [Deterministic] Queue storage lives in .bss, sized at compile time
+static uint8_t engineStore[BUS_DEPTH_ENGINE * sizeof(Command)];
+static uint8_t storageStore[BUS_DEPTH_STORAGE * sizeof(Command)];
+static uint8_t webStore[BUS_DEPTH_WEB * sizeof(Command)];
+static uint8_t uiStore[BUS_DEPTH_UI * sizeof(Command)];
+static StaticQueue_t queueCtl[(size_t)Subsystem::COUNT];
+
+struct QueueSpec {
+    uint8_t* storage;
+    uint8_t depth;
+};
+
+static const QueueSpec QUEUE_SPECS[(size_t)Subsystem::COUNT] = {
+    { engineStore,  BUS_DEPTH_ENGINE },
+    { storageStore, BUS_DEPTH_STORAGE },
+    { webStore,     BUS_DEPTH_WEB },
+    { uiStore,      BUS_DEPTH_UI },
+};
+
+MessageBus& MessageBus::getInstance() {
+    static MessageBus instance;
+    return instance;
+}
+
+MessageBus::MessageBus() {
+    statsLock = portMUX_INITIALIZER_UNLOCKED;
+    memset(stats, 0, sizeof(stats));
+    for (size_t i = 0; i < (size_t)Subsystem::COUNT; i++) queues[i] = NULL;
+}
+
+void MessageBus::init() {
+    for (size_t i = 0; i < (size_t)Subsystem::COUNT; i++) {
+        if (queues[i] != NULL) continue;
+        queues[i] = xQueueCreateStatic(QUEUE_SPECS[i].depth, sizeof(Command),
+                                       QUEUE_SPECS[i].storage, &queueCtl[i]);
+        stats[i].depth = QUEUE_SPECS[i].depth;
+        if (queues[i] == NULL && ENABLE_SERIAL_LOG) {
+            Serial.printf("[CRITICAL] Bus queue %s Init Failed!\n", name((Subsystem)i));
+        }
+    }
+}
+
+bool MessageBus::post(Subsystem to, Command cmd, TickType_t wait) {
+    size_t idx = (size_t)to;
+    if (idx >= (size_t)Subsystem::COUNT || queues[idx] == NULL) return false;
+
+    cmd.postedAt = millis();
+    bool ok = (xQueueSend(queues[idx], &cmd, wait) == pdTRUE);
+    uint8_t depth = (uint8_t)uxQueueMessagesWaiting(queues[idx]);
+
+    portENTER_CRITICAL(&statsLock);
+    if (ok) stats[idx].posted++;
+    else    stats[idx].dropped++;
+    if (depth > stats[idx].peakDepth) stats[idx].peakDepth = depth;
+    portEXIT_CRITICAL(&statsLock);
+
+    if (!ok && ENABLE_SERIAL_LOG) {
+        Serial.printf("[BUS-WARN] %s queue full, cmd %u dropped\n", name(to), (unsigned)cmd.id);
+    }
+    return ok;
+}
+
+bool MessageBus::receive(Subsystem self, Command& out, TickType_t wait) {
+    size_t idx = (size_t)self;
+    if (idx >= (size_t)Subsystem::COUNT || queues[idx] == NULL) return false;
+    return xQueueReceive(queues[idx], &out, wait) == pdTRUE;
+}
+
+void MessageBus::markHandled(Subsystem self, const Command& cmd) {
+    size_t idx = (size_t)self;
+    if (idx >= (size_t)Subsystem::COUNT) return;
+
+    uint32_t latency = millis() - cmd.postedAt;
+
+    portENTER_CRITICAL(&statsLock);
+    stats[idx].handled++;
+    stats[idx].totalLatencyMs += latency;
+    if (latency > stats[idx].maxLatencyMs) stats[idx].maxLatencyMs = latency;
+    portEXIT_CRITICAL(&statsLock);
+}
+
+BusStats MessageBus::getStats(Subsystem s) {
+    BusStats out;
+    memset(&out, 0, sizeof(out));
+    size_t idx = (size_t)s;
+    if (idx >= (size_t)Subsystem::COUNT) return out;
+
+    portENTER_CRITICAL(&statsLock);
+    out = stats[idx];
+    portEXIT_CRITICAL(&statsLock);
+    return out;
+}
+
+const char* MessageBus::name(Subsystem s) {
+    switch (s) {
+        case Subsystem::ENGINE:  return "ENGINE";
+        case Subsystem::STORAGE: return "STORAGE";
+        case Subsystem::WEB:     return "WEB";
+        case Subsystem::UI:      return "UI";
+        default:                 return "?";
+    }
+}
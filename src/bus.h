@@ -0,0 +1,106 @@
+/*
+ * ======================================================================================
+ * FILE: bus.h
+ * DESCRIPTION: Typed command/event bus. One bounded queue per subsystem task.
+ * ======================================================================================
+ */
+
+#pragma once
+
+#include "config.h"
+#include "types.h"
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+
+// Each subsystem owns one queue and drains it from its own task
+enum class Subsystem : uint8_t {
+    ENGINE,     // AttackCore task
+    STORAGE,    // StorageCore task (NVS, event log)
+    WEB,        // NetCore task (WebServer / DNS)
+    UI,         // Arduino loop task
+    COUNT
+};
+
+enum class CommandId : uint8_t {
+    NONE,
+
+    // -> ENGINE
+    SET_ATTACK,       // arg = AttackType
+    STOP_ATTACK,
+    SET_TARGET,       // bssid + channel
+    SCAN,             // Reply: SCAN_DONE to replyTo
+    CLEAR_LOGS,
+
+    // -> STORAGE
+    SAVE_CRED,        // text
+    SAVE_SETTINGS,    // bssid + channel
+    LOG_EVENT,        // arg = EventKind, text = [len][payload]
+
+    // -> WEB
+    WEB_START,        // arg = evilTwinMode
+    WEB_STOP,
+
+    // Events (-> replyTo)
+    SCAN_DONE,        // arg = result count (saturated)
+
+    // -> UI
+    ALERT             // arg = rule index, text = banner line
+};
+
+struct Command {
+    CommandId id;
+    Subsystem replyTo;        // Subsystem::COUNT = no reply wanted
+    uint8_t arg;
+    uint8_t bssid[6];
+    int16_t channel;
+    uint32_t postedAt;        // millis() at post (latency accounting)
+    char text[64];
+
+    Command() : id(CommandId::NONE), replyTo(Subsystem::COUNT), arg(0), channel(0), postedAt(0) {
+        memset(bssid, 0, sizeof(bssid));
+        memset(text, 0, sizeof(text));
+    }
+    explicit Command(CommandId cmdId, uint8_t cmdArg = 0) : Command() {
+        id = cmdId;
+        arg = cmdArg;
+    }
+};
+
+// Per-subsystem throughput counters
+struct BusStats {
+    uint32_t posted;
+    uint32_t handled;
+    uint32_t dropped;          // Queue full at post time
+    uint32_t totalLatencyMs;   // Sum of post -> handled
+    uint32_t maxLatencyMs;
+    uint8_t  depth;            // Configured queue depth
+    uint8_t  peakDepth;        // High-water mark
+};
+
+class MessageBus {
+public:
+    static MessageBus& getInstance();
+    MessageBus(const MessageBus&) = delete;
+    void operator=(const MessageBus&) = delete;
+
+    // Lifecycle (static storage, no heap)
+    void init();
+
+    // Producer side (any task). `wait` = ticks to block when the queue is full.
+    bool post(Subsystem to, Command cmd, TickType_t wait = 0);
+
+    // Consumer side (owning task only)
+    bool receive(Subsystem self, Command& out, TickType_t wait);
+    void markHandled(Subsystem self, const Command& cmd);
+
+    // Diagnostics
+    BusStats getStats(Subsystem s);
+    static const char* name(Subsystem s);
+
+private:
+    MessageBus();
+
+    QueueHandle_t queues[(size_t)Subsystem::COUNT];
+    BusStats stats[(size_t)Subsystem::COUNT];
+    portMUX_TYPE statsLock;
+};
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <Arduino.h>
+#include "profile.h"
 
 // ======================================================================================
 // 0. DEPLOYMENT PROFILE (OPERATIONAL CONTEXT)
@@ -18,11 +19,19 @@
 // [SELECTOR] Choose Operational Mode
 #define SYSTEM_MODE         MODE_DEV
 
-// [SELECTOR] Resource Profile
-#define PROFILE_STEALTH     0   
-#define PROFILE_PERFORMANCE 1   
+// [SELECTOR] Resource Profile: PROFILE_PERFORMANCE / PROFILE_STEALTH / PROFILE_MONITOR
+// (sizes and RAM budgets live in profile.h)
+#ifndef RESOURCE_PROFILE
+    #define RESOURCE_PROFILE    PROFILE_PERFORMANCE
+#endif
+
+#if (RESOURCE_PROFILE != PROFILE_PERFORMANCE) && (RESOURCE_PROFILE != PROFILE_STEALTH) && (RESOURCE_PROFILE != PROFILE_MONITOR)
+    #error "[CFG-CRITICAL] Unknown RESOURCE_PROFILE."
+#endif
 
-#define RESOURCE_PROFILE    PROFILE_PERFORMANCE
+using Profile = ResourceProfile<RESOURCE_PROFILE>;
+
+#define FW_VERSION          "0.2.0-alpha"
 
 // ======================================================================================
 // 1. HARDWARE PINOUT (PHYSICAL LAYER) 
@@ -78,17 +87,10 @@
 #define MIN_RSSI_THRESHOLD    -85        
 
 // Buffer Sizes based on Profile
-#if RESOURCE_PROFILE == PROFILE_PERFORMANCE
-    #define MAX_INPUT_LEN     128
-    #define MAX_LOGS          100
-    #define MAX_CREDS         50
-    #define MAX_SCAN_RESULTS  50
-#else // STEALTH
-    #define MAX_INPUT_LEN     64
-    #define MAX_LOGS          20
-    #define MAX_CREDS         10
-    #define MAX_SCAN_RESULTS  15
-#endif
+#define MAX_INPUT_LEN         Profile::maxInputLen
+#define MAX_LOGS              Profile::maxLogs
+#define MAX_CREDS             Profile::maxCreds
+#define MAX_SCAN_RESULTS      Profile::maxScanResults
 
 // --- INTEGRITY VALIDATION ---
 #ifndef NVS_MAGIC_KEY
@@ -117,11 +119,7 @@
 #define WEB_SESSION_TIMEOUT   300000     
 
 // Client limits based on profile
-#if RESOURCE_PROFILE == PROFILE_PERFORMANCE
-    #define MAX_WEB_CLIENTS   4
-#else
-    #define MAX_WEB_CLIENTS   1
-#endif
+#define MAX_WEB_CLIENTS       Profile::maxWebClients
 
 // ======================================================================================
 // 5. LOGGING & MONITORING
@@ -139,16 +137,158 @@
 // ======================================================================================
 // 6. TACTICAL PARAMETERS 
 // ======================================================================================
-#define ATTACK_TASK_STACK     8192
+#define ATTACK_TASK_STACK     Profile::attackTaskStack
 #define ATTACK_TASK_PRIO      1
+#define NET_TASK_STACK        Profile::netTaskStack
+#define NET_TASK_PRIO         1
+#define STORAGE_TASK_STACK    Profile::storageTaskStack
+#define STORAGE_TASK_PRIO     1
+#define LOOP_TASK_STACK       8192       // Arduino core default (CONFIG_ARDUINO_LOOP_STACK_SIZE)
 
-// Stack & Heap Safety
-#if ATTACK_TASK_STACK < 4096
-    #error "[MEM-CRITICAL] Attack Stack unsafe for TLS/WiFi stack."
-#endif
+// Stack & Heap Safety: minimums enforced per profile in profile.h,
+// total static RAM against the profile budget in mem_budget.cpp
 
 // Timing Parameters
 #define DEAUTH_PACKET_DELAY   10
 #define DEAUTH_BURST_SIZE     5
 #define CHANNEL_HOP_DELAY     150
-#define JAMMER_HOP_SPEED      50
\ No newline at end of file
+#define JAMMER_HOP_SPEED      50
+
+// ======================================================================================
+// 7. PASSIVE DETECTION
+// ======================================================================================
+#define PACKET_QUEUE_LEN      Profile::packetQueueLen   // Sniffer -> Task queue depth
+#define PACKET_BATCH_LIMIT    16         // Max frames consumed per runLoop pass
+
+// Spoofed Deauth Guard (per-BSSID fingerprint table)
+#define GUARD_MAX_BSSIDS      Profile::guardMaxBssids
+#define GUARD_MIN_BEACONS     8          // Beacons before a fingerprint is trusted
+#define GUARD_SEQ_WINDOW      256        // Max forward seq gap for a genuine AP frame
+#define GUARD_RSSI_TOL_DB     8          // Minimum RSSI envelope (dB)
+#define GUARD_STALE_MS        60000      // Unseen fingerprints are recycled after this
+#define GUARD_ALERT_EVERY     64         // Re-log a spoofed BSSID every N frames
+
+// Site Survey (per-AP streaming RSSI statistics)
+#define SURVEY_MAX_APS        Profile::surveyMaxAps
+#define SURVEY_HIST_FLOOR     -100       // dBm, lower edge of the percentile sketch
+#define SURVEY_HIST_STEP      4          // dB per sketch bucket
+#define SURVEY_HIST_BINS      20         // -100 .. -20 dBm
+#define SURVEY_EWMA_SHIFT     3          // EWMA weight 1/8
+#define SURVEY_ROGUE_SLOTS    8          // Rogue-AP BSSIDs remembered once flagged
+
+// BLE Advertisement Flood Detector (decaying vendor-pattern counting table)
+#define BLE_PATTERN_SLOTS     Profile::blePatternSlots
+#define BLE_DEDUP_SLOTS       Profile::bleDedupSlots
+#define BLE_QUEUE_LEN         Profile::bleQueueLen      // GAP callback -> Task queue depth (static)
+#define BLE_PATTERN_BYTES     2          // Manufacturer data bytes keyed after the company ID
+#define BLE_PROBE_LIMIT       8          // Open-addressing probe window
+#define BLE_DECAY_MS          1000       // Counts halve and the address window rotates
+#define BLE_FLOOD_MIN_RATE    12         // Decayed unique adverts per pattern
+#define BLE_FLOOD_MIN_CHURN   6          // New addresses vs. previous window
+#define BLE_ALERT_EVERY       256        // Re-log a flooding pattern every N adverts
+#define BLE_SCAN_INTERVAL     0x50       // 50 ms (0.625 ms units); window = interval, 100% duty
+
+// Correlated 2.4 GHz timeline (WiFi frames per channel vs. NRF24 carrier energy)
+#define RF_TIMELINE_SLOTS     Profile::rfTimelineSlots
+#define RF_SLOT_MS            2000       // One slot spans a full WiFi hop cycle
+#define RF_SWEEP_CHUNK        8          // NRF24 bins sampled per engine pass (~1 ms)
+#define RF_ENERGY_BUSY_PCT    30         // Carrier occupancy that marks a channel busy
+#define RF_WIFI_BUSY_FPS      40         // Decoded frames/s that explain that energy as WiFi
+
+#if GUARD_SEQ_WINDOW >= 2048
+    #error "[CFG-CRITICAL] GUARD_SEQ_WINDOW must stay below half the 12-bit seq space."
+#endif
+#if RF_SLOT_MS < (13 * CHANNEL_HOP_DELAY)
+    #error "[CFG-CRITICAL] RF_SLOT_MS must cover one hop over all 13 WiFi channels."
+#endif
+static_assert(BLE_PROBE_LIMIT <= BLE_PATTERN_SLOTS, "[CFG-CRITICAL] BLE_PROBE_LIMIT exceeds the pattern table.");
+
+// ======================================================================================
+// 8. MESSAGE BUS (per-subsystem bounded queues)
+// ======================================================================================
+#define BUS_DEPTH_ENGINE      8
+#define BUS_DEPTH_STORAGE     8
+#define BUS_DEPTH_WEB         4
+#define BUS_DEPTH_UI          8
+#define BUS_POST_WAIT_MS      20         // Producer back-pressure before a drop
+#define WEB_SCAN_TIMEOUT_MS   8000       // Web handler wait for an engine scan
+#define SCAN_CACHE_TTL_MS     30000      // Web serves the cached sweep while younger than this
+#define WEB_CHUNK_SIZE        1024       // Flash-to-socket slice for embedded dashboard assets
+
+// ======================================================================================
+// 9. BENCHMARK SUITE
+// ======================================================================================
+#define BENCH_MAX_SAMPLES     64         // Per case (static sample buffer)
+#define BENCH_SAMPLES_OLED    32
+#define BENCH_SAMPLES_NRF     16
+#define BENCH_SAMPLES_NVS     16
+#define BENCH_SAMPLES_SNIFFER 64
+#define BENCH_SAMPLES_JSON    64
+#define BENCH_SNIFFER_BATCH   32         // Synthetic frames per sniffer sample
+
+#if (BENCH_SAMPLES_OLED > BENCH_MAX_SAMPLES) || (BENCH_SAMPLES_NRF > BENCH_MAX_SAMPLES) || \
+    (BENCH_SAMPLES_NVS > BENCH_MAX_SAMPLES) || (BENCH_SAMPLES_SNIFFER > BENCH_MAX_SAMPLES) || \
+    (BENCH_SAMPLES_JSON > BENCH_MAX_SAMPLES)
+    #error "[CFG-CRITICAL] Benchmark sample count exceeds BENCH_MAX_SAMPLES."
+#endif
+
+// ======================================================================================
+// 10. EVENT STORE (append-only log on the `spiffs` data partition)
+// ======================================================================================
+#define EVT_PARTITION_LABEL   "spiffs"
+#define EVT_SECTOR_SIZE       4096
+#define EVT_SEGMENT_SIZE      (4 * EVT_SECTOR_SIZE)   // 640 KB partition -> 40 segments
+#define EVT_MAX_SEGMENTS      48         // RAM time index capacity
+#define EVT_WRITE_BUF         256        // RAM staging, flushed as one flash write
+#define EVT_FLUSH_MS          5000       // Max age of staged records (power-loss window)
+#define EVT_SURVEY_PERIOD_MS  300000     // Survey snapshot: new or materially changed APs
+#define EVT_SURVEY_BUDGET     256        // Max survey bytes per snapshot (~8 APs; the rest wait)
+#define EVT_SURVEY_DELTA_DB   6          // RSSI EWMA move that counts as a change
+#define EVT_SURVEY_REFRESH_MS 21600000   // Unchanged APs still heard: re-logged every 6 h
+#define EVT_QUERY_LIMIT       200        // Records per /api/events response (use `next` to page)
+
+#if (EVT_SEGMENT_SIZE % EVT_SECTOR_SIZE) != 0
+    #error "[CFG-CRITICAL] EVT_SEGMENT_SIZE must be a multiple of the flash sector size."
+#endif
+#if EVT_WRITE_BUF < 128
+    #error "[CFG-CRITICAL] EVT_WRITE_BUF must hold at least one maximum-size record."
+#endif
+
+// ======================================================================================
+// 11. HEALTH COUNTERS (RTC_NOINIT block mirrored to NVS, coredump summary)
+// ======================================================================================
+#define HEALTH_PERSIST_MS     60000      // Min interval between NVS mirror writes (flash wear)
+#define HEALTH_BOOT_SCREEN_MS 3000       // OLED reset report after a WDT / panic / brownout
+
+#if HEALTH_PERSIST_MS < 10000
+    #error "[CFG-CRITICAL] HEALTH_PERSIST_MS too short: NVS wear."
+#endif
+
+// ======================================================================================
+// 12. ALERT ENGINE (rules over detector metrics, see alert_engine.cpp)
+// ======================================================================================
+#define ALERT_TICK_MS         500        // Fixed evaluation period (AttackCore)
+#define ALERT_WINDOW_TICKS    10         // Sliding window for rates: 5 s
+#define ALERT_DEAUTH_SLOTS    16         // BSSIDs tracked for the deauth rate
+#define ALERT_MAX_RULES       8          // activeMask width
+#define ALERT_HISTORY         16         // Transitions kept for /api/alerts
+#define ALERT_COOLDOWN_MS     60000      // Min gap between two openings of one rule
+#define ALERT_BANNER_MS       4000       // OLED banner when an alert opens
+
+// Thresholds: open at RAISE, close below CLEAR (CLEAR < RAISE = hysteresis)
+#define ALERT_DEAUTH_RAISE    20         // Deauth + disassoc frames/s for one BSSID
+#define ALERT_DEAUTH_CLEAR    5
+#define ALERT_UTIL_RAISE      70         // NRF24 carrier occupancy % on any WiFi channel
+#define ALERT_UTIL_CLEAR      50
+#define ALERT_ROGUE_RAISE     3          // Beacons from flagged rogue BSSIDs within the window
+#define ALERT_ROGUE_CLEAR     1
+#define ALERT_BLE_RAISE       (2 * BLE_FLOOD_MIN_RATE)   // Busiest vendor-pattern rate
+#define ALERT_BLE_CLEAR       BLE_FLOOD_MIN_RATE
+
+#if (ALERT_DEAUTH_CLEAR > ALERT_DEAUTH_RAISE) || (ALERT_UTIL_CLEAR > ALERT_UTIL_RAISE) || \
+    (ALERT_ROGUE_CLEAR > ALERT_ROGUE_RAISE) || (ALERT_BLE_CLEAR > ALERT_BLE_RAISE)
+    #error "[CFG-CRITICAL] Alert CLEAR thresholds must not exceed RAISE (no hysteresis)."
+#endif
+#if ALERT_WINDOW_TICKS > 255 || ALERT_MAX_RULES > 8
+    #error "[CFG-CRITICAL] ALERT_WINDOW_TICKS must fit uint8_t and ALERT_MAX_RULES the 8-bit mask."
+#endif
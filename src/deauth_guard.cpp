@@ -0,0 +1,114 @@
+/*
+ * ======================================================================================
+ * FILE: deauth_guard.cpp
+ * DESCRIPTION: Fixed-size fingerprint table. Integer-only, no allocation, task context.
+ * ======================================================================================
+ */
+
+#include "deauth_guard.h"
+#include <cstring>
+
+// EWMA weight 1/8 (shift), RSSI kept in Q4 to retain sub-dB resolution
+static const int EWMA_SHIFT = 3;
+static const int RSSI_Q = 16;
+
+DeauthGuard::DeauthGuard() : used(0), spoofTotal(0) {
+    memset(table, 0, sizeof(table));
+}
+
+void DeauthGuard::reset() {
+    memset(table, 0, sizeof(table));
+    used = 0;
+    spoofTotal = 0;
+}
+
+BssidTrack* DeauthGuard::find(const uint8_t* bssid) {
+    for (size_t i = 0; i < used; i++) {
+        if (memcmp(table[i].bssid, bssid, 6) == 0) return &table[i];
+    }
+    return nullptr;
+}
+
+const BssidTrack* DeauthGuard::find(const uint8_t* bssid) const {
+    return const_cast<DeauthGuard*>(this)->find(bssid);
+}
+
+BssidTrack* DeauthGuard::claim(const uint8_t* bssid, uint32_t now) {
+    BssidTrack* slot = nullptr;
+    if (used < GUARD_MAX_BSSIDS) {
+        slot = &table[used++];
+    } else {
+        // [Bounded] Table full: recycle the least recently seen AP
+        slot = &table[0];
+        for (size_t i = 1; i < used; i++) {
+            if ((now - table[i].lastSeen) > (now - slot->lastSeen)) slot = &table[i];
+        }
+    }
+    memset(slot, 0, sizeof(BssidTrack));
+    memcpy(slot->bssid, bssid, 6);
+    return slot;
+}
+
+void DeauthGuard::onBeacon(const uint8_t* bssid, uint16_t seq, int rssi, uint32_t now) {
+    BssidTrack* t = find(bssid);
+
+    // A fingerprint that went quiet has lost track of the seq counter: relearn it
+    if (t && (now - t->lastSeen) > GUARD_STALE_MS) {
+        t->beacons = 0;
+    }
+    if (!t) t = claim(bssid, now);
+
+    int16_t x = (int16_t)(rssi * RSSI_Q);
+    if (t->beacons == 0) {
+        t->rssiMean = x;
+        t->rssiDev = (GUARD_RSSI_TOL_DB * RSSI_Q) / 2;
+    } else {
+        int16_t diff = x - t->rssiMean;
+        t->rssiMean += diff >> EWMA_SHIFT;
+        int16_t absDiff = (diff < 0) ? -diff : diff;
+        t->rssiDev += (int16_t)(absDiff - (int16_t)t->rssiDev) >> EWMA_SHIFT;
+    }
+
+    t->lastSeq = seq & 0x0FFF;
+    t->lastSeen = now;
+    if (t->beacons < 0xFFFF) t->beacons++;
+}
+
+GuardVerdict DeauthGuard::onDeauth(const uint8_t* src, const uint8_t* bssid, uint16_t seq, int rssi) {
+    // Only frames claiming to come from the AP itself can be fingerprinted
+    if (memcmp(src, bssid, 6) != 0) return GuardVerdict::UNKNOWN;
+
+    BssidTrack* t = find(bssid);
+    if (!t || t->beacons < GUARD_MIN_BEACONS) return GuardVerdict::UNKNOWN;
+
+    GuardVerdict verdict = GuardVerdict::GENUINE;
+
+    // 1. Sequence progression: genuine frames sit just ahead of the last beacon
+    //    (gap 0 is a retransmission of the previous frame)
+    uint16_t gap = (uint16_t)((seq - t->lastSeq) & 0x0FFF);
+    if (gap > GUARD_SEQ_WINDOW) {
+        verdict = GuardVerdict::SPOOF_SEQ;
+    } else {
+        // 2. RSSI envelope: max(floor, 4 * mean abs deviation)
+        int16_t x = (int16_t)(rssi * RSSI_Q);
+        int16_t diff = x - t->rssiMean;
+        if (diff < 0) diff = -diff;
+        int16_t tol = (int16_t)(4 * t->rssiDev);
+        if (tol < GUARD_RSSI_TOL_DB * RSSI_Q) tol = GUARD_RSSI_TOL_DB * RSSI_Q;
+        if (diff > tol) verdict = GuardVerdict::SPOOF_RSSI;
+    }
+
+    if (verdict == GuardVerdict::GENUINE) {
+        t->lastSeq = seq & 0x0FFF;
+    } else {
+        if (t->spoofed < 0xFFFF) t->spoofed++;
+        spoofTotal++;
+    }
+    return verdict;
+}
+
+bool DeauthGuard::shouldAlert(const uint8_t* bssid) const {
+    const BssidTrack* t = find(bssid);
+    if (!t || t->spoofed == 0) return false;
+    return (t->spoofed == 1) || (t->spoofed % GUARD_ALERT_EVERY == 0);
+}
@@ -0,0 +1,59 @@
+/*
+ * ======================================================================================
+ * FILE: deauth_guard.h
+ * DESCRIPTION: Spoofed Deauth/Disassoc detection via per-BSSID beacon fingerprints.
+ * ======================================================================================
+ */
+
+#pragma once
+
+#include "config.h"
+#include <cstdint>
+#include <cstddef>
+
+// Verdict for a single deauth/disassoc frame
+enum class GuardVerdict : uint8_t {
+    UNKNOWN,      // No trusted fingerprint (or client-originated frame)
+    GENUINE,      // Sequence and RSSI fit the real AP
+    SPOOF_SEQ,    // Sequence number outside the AP's progression window
+    SPOOF_RSSI    // Signal strength outside the AP's RSSI envelope
+};
+
+// Fingerprint learned from beacons (fixed-point, 20 bytes)
+struct BssidTrack {
+    uint8_t  bssid[6];
+    uint16_t lastSeq;     // Last accepted 12-bit sequence number
+    int16_t  rssiMean;    // EWMA, Q4 dBm
+    uint16_t rssiDev;     // EWMA of |x - mean|, Q4 dB
+    uint16_t beacons;     // Saturating beacon counter
+    uint16_t spoofed;     // Saturating spoof counter
+    uint32_t lastSeen;    // millis() of last beacon
+};
+
+class DeauthGuard {
+public:
+    DeauthGuard();
+
+    void reset();
+
+    // Learning path (beacons). Evicts the stalest entry when the table is full.
+    void onBeacon(const uint8_t* bssid, uint16_t seq, int rssi, uint32_t now);
+
+    // Classification path. `src` is addr2, `bssid` is addr3.
+    GuardVerdict onDeauth(const uint8_t* src, const uint8_t* bssid, uint16_t seq, int rssi);
+
+    // True when the last spoof verdict for this track should be surfaced to the log
+    bool shouldAlert(const uint8_t* bssid) const;
+
+    uint32_t getSpoofCount() const { return spoofTotal; }
+    size_t getTrackedCount() const { return used; }
+
+private:
+    BssidTrack table[GUARD_MAX_BSSIDS];
+    size_t used;
+    uint32_t spoofTotal;
+
+    BssidTrack* find(const uint8_t* bssid);
+    const BssidTrack* find(const uint8_t* bssid) const;
+    BssidTrack* claim(const uint8_t* bssid, uint32_t now);
+};
@@ -0,0 +1,661 @@
+/*
+ * ======================================================================================
+ * FILE: event_store.cpp
+ * DESCRIPTION: Event log implementation. Only StorageCore writes to flash; readers walk
+ *              segments without holding the lock (records are CRC-checked).
+ * ======================================================================================
+ */
+
+#include "event_store.h"
+#include "survey.h"
+#include "ble_guard.h"
+#include "alert_engine.h"
+#include <Arduino.h>
+#include <esp_rom_crc.h>
+#include <esp_system.h>
+#include <cstring>
+
+#define EVT_MAGIC_HEAD  0x4C565448   // "HTVL"
+#define EVT_MAGIC_FOOT  0x4C56544C   // "LTVL"
+
+struct __attribute__((packed)) SegHeader {
+    uint32_t magic;
+    uint32_t seq;
+    uint32_t eraseCount;
+    uint64_t baseTime;
+    uint16_t crc;
+};
+
+struct __attribute__((packed)) SegFooter {
+    uint32_t magic;
+    uint16_t records;
+    uint16_t used;
+    uint64_t lastTime;
+    uint16_t crc;
+};
+
+static_assert(sizeof(SegHeader) <= EVT_HEADER_SIZE && sizeof(SegFooter) <= EVT_FOOTER_SIZE,
+              "[CFG-CRITICAL] Segment header/footer exceed their reserved space.");
+static_assert(EVT_SEGMENT_SIZE - EVT_HEADER_SIZE - EVT_FOOTER_SIZE <= 0xFFFF,
+              "[CFG-CRITICAL] Segment data area must fit the 16-bit `used` field.");
+
+static inline uint16_t crc16(const void* data, size_t len) {
+    return esp_rom_crc16_le(0, (const uint8_t*)data, (uint32_t)len);
+}
+
+// --- RECORD CODEC ---
+
+static size_t putVarint(uint8_t* p, uint32_t v) {
+    size_t n = 0;
+    while (v >= 0x80) {
+        p[n++] = (uint8_t)(v | 0x80);
+        v >>= 7;
+    }
+    p[n++] = (uint8_t)v;
+    return n;
+}
+
+static size_t getVarint(const uint8_t* p, size_t avail, uint32_t& v) {
+    v = 0;
+    for (size_t i = 0; i < 5 && i < avail; i++) {
+        v |= (uint32_t)(p[i] & 0x7F) << (7 * i);
+        if (!(p[i] & 0x80)) return i + 1;
+    }
+    return 0;
+}
+
+static size_t encodeRecord(uint8_t* out, uint8_t kind, uint32_t dt, const void* payload, size_t len) {
+    uint8_t n = (uint8_t)putVarint(out + 2, dt);
+    out[0] = (uint8_t)(1 + n + len);
+    out[1] = kind;
+    memcpy(out + 2 + n, payload, len);
+    size_t body = 1 + out[0];
+    uint16_t c = crc16(out, body);
+    out[body] = (uint8_t)(c & 0xFF);
+    out[body + 1] = (uint8_t)(c >> 8);
+    return body + 2;
+}
+
+// Record size, 0 at the end of written data (erased flash), -1 if corrupt.
+// `time` carries the delta base in and the record time out.
+static int decodeRecord(const uint8_t* p, size_t avail, uint64_t& time, EventRecord* out) {
+    if (avail == 0 || p[0] == 0xFF) return 0;
+    size_t len = p[0];
+    size_t total = 1 + len + 2;
+    if (len < 2 || total > EVT_MAX_RECORD || total > avail) return -1;
+    uint16_t stored = (uint16_t)p[1 + len] | ((uint16_t)p[2 + len] << 8);
+    if (crc16(p, 1 + len) != stored) return -1;
+
+    uint32_t dt;
+    size_t n = getVarint(p + 2, len - 1, dt);
+    if (n == 0) return -1;
+    // A short dt varint leaves room for more than EVT_MAX_PAYLOAD: never written by append()
+    if (len - 1 - n > EVT_MAX_PAYLOAD) return -1;
+    time += dt;
+    if (out) {
+        out->time = time;
+        out->kind = p[1];
+        out->len = (uint8_t)(len - 1 - n);
+        memcpy(out->data, p + 2 + n, out->len);
+    }
+    return (int)total;
+}
+
+// Sliding flash window: guarantees a whole record is buffered when one exists
+class SegReader {
+public:
+    SegReader(const esp_partition_t* p, uint32_t start, uint32_t length)
+        : part(p), base(start), end(length), winOff(0), winLen(0) {}
+
+    const uint8_t* at(uint32_t off, size_t& avail) {
+        uint32_t need = (end - off < EVT_MAX_RECORD) ? end - off : EVT_MAX_RECORD;
+        if (off < winOff || off + need > winOff + winLen) {
+            winOff = off;
+            winLen = (uint16_t)((end - off < sizeof(win)) ? end - off : sizeof(win));
+            if (esp_partition_read(part, base + off, win, winLen) != ESP_OK) winLen = 0;
+        }
+        avail = (winOff + winLen > off) ? winOff + winLen - off : 0;
+        return win + (off - winOff);
+    }
+
+private:
+    const esp_partition_t* part;
+    uint32_t base;
+    uint32_t end;
+    uint32_t winOff;
+    uint16_t winLen;
+    uint8_t win[256];
+};
+
+// --- LIFECYCLE ---
+
+EventStore& EventStore::getInstance() {
+    static EventStore instance;
+    return instance;
+}
+
+EventStore::EventStore() : part(nullptr), segCount(0), active(-1), nextSeq(1), clockBase(0), prevTime(0),
+                           stagedLen(0), stagedAt(0), corrupt(0), flushes(0), lastSurveyMs(0),
+                           surveyCursor(0) {
+    mutex = xSemaphoreCreateMutex();
+    memset(index, 0, sizeof(index));
+    memset(staged, 0xFF, sizeof(staged));
+    memset(surveyMarks, 0, sizeof(surveyMarks));
+}
+
+bool EventStore::mount() {
+    const esp_partition_t* p = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_DATA_SPIFFS,
+                                                        EVT_PARTITION_LABEL);
+    if (!p || p->size < 2 * EVT_SEGMENT_SIZE) {
+        if (ENABLE_SERIAL_LOG) Serial.println("[EVT] Partition not found, event log disabled.");
+        return false;
+    }
+    part = p;
+    segCount = (uint16_t)(part->size / EVT_SEGMENT_SIZE);
+    if (segCount > EVT_MAX_SEGMENTS) segCount = EVT_MAX_SEGMENTS;
+
+    // 1. Rebuild the index from headers and footers (one scan for unsealed segments)
+    int newest = -1;
+    int torn = -1;
+    uint64_t lastTime = 0;
+    bool anyRecords = false;
+    for (int s = 0; s < segCount; s++) {
+        EvtSegIndex& e = index[s];
+        memset(&e, 0, sizeof(e));
+        e.state = SegState::FREE;
+
+        SegHeader h;
+        if (esp_partition_read(part, segOffset(s), &h, sizeof(h)) != ESP_OK) continue;
+        if (h.magic != EVT_MAGIC_HEAD || h.crc != crc16(&h, sizeof(h) - 2)) continue;   // Never used (or foreign data)
+
+        e.seq = h.seq;
+        e.eraseCount = h.eraseCount;
+        e.firstTime = e.lastTime = h.baseTime;
+
+        SegFooter f;
+        bool sealed = esp_partition_read(part, segOffset(s) + EVT_SEGMENT_SIZE - EVT_FOOTER_SIZE, &f, sizeof(f)) == ESP_OK &&
+                      f.magic == EVT_MAGIC_FOOT && f.crc == crc16(&f, sizeof(f) - 2);
+        if (sealed) {
+            e.state = SegState::SEALED;
+            e.records = f.records;
+            e.used = f.used;
+            e.lastTime = f.lastTime;
+        } else {
+            e.state = SegState::ACTIVE;
+            if (scanSegment(s)) torn = s;
+        }
+
+        if (e.records > 0) {
+            anyRecords = true;
+            if (e.lastTime > lastTime) lastTime = e.lastTime;
+        }
+        if (e.seq >= nextSeq) nextSeq = e.seq + 1;
+        if (newest < 0 || e.seq > index[newest].seq) newest = s;
+    }
+
+    // 2. Only the newest segment may stay open: older unsealed ones were cut by a reset mid-rotation
+    for (int s = 0; s < segCount; s++) {
+        if (index[s].state != SegState::ACTIVE || s == newest) continue;
+        active = (int16_t)s;
+        sealActive();
+    }
+    if (newest >= 0 && index[newest].state == SegState::ACTIVE) {
+        active = (int16_t)newest;
+        prevTime = index[newest].lastTime;
+        if (torn == newest) {
+            // Reset mid-write: seal so appends never follow a torn record
+            if (ENABLE_SERIAL_LOG) Serial.printf("[EVT] Torn record in segment %d, sealing.\n", newest);
+            sealActive();
+        }
+    }
+
+    // 3. Log clock continues after the newest record
+    clockBase = anyRecords ? lastTime + 1 : 0;
+
+    EvtBoot boot = { (uint8_t)esp_reset_reason() };
+    append(EVT_BOOT, now(), &boot, sizeof(boot));
+    flush();
+
+    if (ENABLE_SERIAL_LOG) {
+        EventStoreStats st = getStats();
+        Serial.printf("[EVT] %u segments, %lu records, %lu/%lu B, erases %lu-%lu\n",
+                      (unsigned)st.segments, (unsigned long)st.records, (unsigned long)st.bytesUsed,
+                      (unsigned long)st.capacity, (unsigned long)st.eraseMin, (unsigned long)st.eraseMax);
+    }
+    return true;
+}
+
+// Rebuilds records/used/lastTime of a segment without a footer. True if the tail is torn.
+bool EventStore::scanSegment(int seg) {
+    EvtSegIndex& e = index[seg];
+    SegReader reader(part, segOffset(seg) + EVT_HEADER_SIZE, dataCapacity());
+    uint64_t time = e.firstTime;
+    uint32_t off = 0;
+    uint16_t records = 0;
+    bool torn = false;
+
+    while (off < dataCapacity()) {
+        size_t avail;
+        const uint8_t* p = reader.at(off, avail);
+        int n = decodeRecord(p, avail, time, nullptr);
+        if (n == 0) break;
+        if (n < 0) { torn = true; corrupt++; break; }
+        off += (uint32_t)n;
+        records++;
+        e.lastTime = time;
+    }
+    e.records = records;
+    e.used = (uint16_t)off;
+    return torn;
+}
+
+// --- PRODUCERS ---
+
+bool EventStore::post(EventKind kind, const void* payload, size_t len) {
+    if (len > EVT_MAX_PAYLOAD) return false;
+    Command cmd(CommandId::LOG_EVENT, (uint8_t)kind);
+    cmd.text[0] = (char)len;
+    memcpy(cmd.text + 1, payload, len);
+    return MessageBus::getInstance().post(Subsystem::STORAGE, cmd, 0);   // Detectors never wait on flash
+}
+
+void EventStore::handleCommand(const Command& cmd) {
+    if (cmd.id != CommandId::LOG_EVENT) return;
+    uint8_t len = (uint8_t)cmd.text[0];
+    if (len > EVT_MAX_PAYLOAD) return;
+    append(cmd.arg, timeOf(cmd.postedAt), cmd.text + 1, len);   // Stamped at detection, not at write
+}
+
+// --- WRITER (StorageCore) ---
+
+void EventStore::append(uint8_t kind, uint64_t time, const void* payload, size_t len) {
+    if (!part || len > EVT_MAX_PAYLOAD) return;
+    if (time < prevTime) time = prevTime;   // Queue latency can reorder by a few ms
+
+    uint8_t rec[EVT_MAX_RECORD];
+    uint64_t dt = time - prevTime;
+    size_t size = 0;
+    if (active >= 0 && dt <= UINT32_MAX) size = encodeRecord(rec, kind, (uint32_t)dt, payload, len);
+
+    if (active < 0 || size == 0 || index[active].used + stagedLen + size > dataCapacity()) {
+        if (active >= 0) sealActive();
+        if (!openSegment(time)) return;
+        size = encodeRecord(rec, kind, 0, payload, len);
+    }
+
+    if (stagedLen + size > EVT_WRITE_BUF) flush();
+    if (stagedLen == 0) stagedAt = millis();
+    memcpy(staged + stagedLen, rec, size);
+    stagedLen += (uint16_t)size;
+    prevTime = time;
+
+    if (xSemaphoreTake(mutex, portMAX_DELAY)) {
+        index[active].lastTime = time;
+        index[active].records++;
+        xSemaphoreGive(mutex);
+    }
+}
+
+void EventStore::flush() {
+    if (!part || active < 0 || stagedLen == 0) return;
+    uint32_t off = segOffset(active) + EVT_HEADER_SIZE + index[active].used;
+    esp_err_t err = esp_partition_write(part, off, staged, stagedLen);
+
+    if (xSemaphoreTake(mutex, portMAX_DELAY)) {
+        if (err == ESP_OK) {
+            index[active].used += stagedLen;
+            flushes++;
+        }
+        xSemaphoreGive(mutex);
+    }
+    if (err != ESP_OK && ENABLE_SERIAL_LOG) Serial.printf("[EVT] Write failed (%d), %u B lost.\n", (int)err, (unsigned)stagedLen);
+    stagedLen = 0;
+}
+
+void EventStore::sealActive() {
+    if (active < 0) return;
+    flush();
+    EvtSegIndex& e = index[active];
+    SegFooter f;
+    f.magic = EVT_MAGIC_FOOT;
+    f.records = e.records;
+    f.used = e.used;
+    f.lastTime = e.lastTime;
+    f.crc = crc16(&f, sizeof(f) - 2);
+    esp_partition_write(part, segOffset(active) + EVT_SEGMENT_SIZE - EVT_FOOTER_SIZE, &f, sizeof(f));
+
+    if (xSemaphoreTake(mutex, portMAX_DELAY)) {
+        e.state = SegState::SEALED;
+        active = -1;
+        xSemaphoreGive(mutex);
+    }
+}
+
+// Never-used segments first, least-worn among them; then the oldest data (ring order).
+// Erase counts travel in the header, so wear stays visible across reformat-free reboots.
+int EventStore::pickSegment() const {
+    int best = -1;
+    for (int s = 0; s < segCount; s++) {
+        if (index[s].state != SegState::FREE) continue;
+        if (best < 0 || index[s].eraseCount < index[best].eraseCount) best = s;
+    }
+    if (best >= 0) return best;
+    for (int s = 0; s < segCount; s++) {
+        if (s == active) continue;
+        if (best < 0 || index[s].seq < index[best].seq) best = s;
+    }
+    return best;
+}
+
+bool EventStore::openSegment(uint64_t baseTime) {
+    int s = pickSegment();
+    if (s < 0) return false;
+    uint32_t erases = index[s].eraseCount + 1;
+
+    // Hide the victim from readers before its data disappears
+    if (xSemaphoreTake(mutex, portMAX_DELAY)) {
+        memset(&index[s], 0, sizeof(index[s]));
+        index[s].eraseCount = erases - 1;
+        index[s].state = SegState::FREE;
+        xSemaphoreGive(mutex);
+    }
+
+    // Sector by sector: each erase stalls the cache, so give the WiFi task a turn in between
+    for (uint32_t off = 0; off < EVT_SEGMENT_SIZE; off += EVT_SECTOR_SIZE) {
+        if (esp_partition_erase_range(part, segOffset(s) + off, EVT_SECTOR_SIZE) != ESP_OK) return false;
+        vTaskDelay(1);
+    }
+
+    SegHeader h;
+    h.magic = EVT_MAGIC_HEAD;
+    h.seq = nextSeq;
+    h.eraseCount = erases;
+    h.baseTime = baseTime;
+    h.crc = crc16(&h, sizeof(h) - 2);
+    if (esp_partition_write(part, segOffset(s), &h, sizeof(h)) != ESP_OK) return false;
+
+    if (xSemaphoreTake(mutex, portMAX_DELAY)) {
+        EvtSegIndex& e = index[s];
+        e.firstTime = e.lastTime = baseTime;
+        e.seq = nextSeq++;
+        e.eraseCount = erases;
+        e.records = 0;
+        e.used = 0;
+        e.state = SegState::ACTIVE;
+        active = (int16_t)s;
+        xSemaphoreGive(mutex);
+    }
+    prevTime = baseTime;
+    return true;
+}
+
+void EventStore::tick() {
+    if (!part) return;
+    uint32_t nowMs = millis();
+    if (stagedLen > 0 && nowMs - stagedAt >= EVT_FLUSH_MS) flush();
+    if (nowMs - lastSurveyMs >= EVT_SURVEY_PERIOD_MS) {
+        snapshotSurvey(nowMs);
+        lastSurveyMs = nowMs;
+    }
+}
+
+// New APs, APs that moved channel or EWMA by EVT_SURVEY_DELTA_DB, and a slow
+// EVT_SURVEY_REFRESH_MS refresh of the rest (still present). Capped at
+// EVT_SURVEY_BUDGET bytes per period, so a dense survey cannot wrap the log
+// and push out the detector events; multi-day surveys survive resets this way.
+void EventStore::snapshotSurvey(uint32_t nowMs) {
+    auto& survey = SiteSurvey::getInstance();
+    size_t n = survey.count();
+    size_t budget = EVT_SURVEY_BUDGET;
+    SurveyRecord r;
+    for (size_t k = 0; k < n; k++) {
+        size_t i = (surveyCursor + k) % n;
+        if (!survey.getRecord(i, r) || r.samples == 0) continue;
+
+        int8_t ewma = (int8_t)(r.ewma / 256);
+        SurveyMark* m = nullptr;
+        SurveyMark* victim = &surveyMarks[0];
+        for (size_t j = 0; j < SURVEY_MAX_APS; j++) {
+            SurveyMark& c = surveyMarks[j];
+            if (c.loggedAt != 0 && memcmp(c.bssid, r.bssid, 6) == 0) { m = &c; break; }
+            if (victim->loggedAt != 0 && (c.loggedAt == 0 || (int32_t)(c.loggedAt - victim->loggedAt) < 0)) victim = &c;
+        }
+        if (m) {
+            if ((int32_t)(r.lastSeen - m->loggedAt) <= 0) continue;          // Not heard since
+            int delta = (int)ewma - (int)m->ewma;
+            bool changed = r.ch != m->ch || delta >= EVT_SURVEY_DELTA_DB || delta <= -EVT_SURVEY_DELTA_DB;
+            if (!changed && nowMs - m->loggedAt < EVT_SURVEY_REFRESH_MS) continue;
+        }
+
+        size_t ssidLen = strnlen(r.ssid, sizeof(r.ssid));
+        if (ssidLen > sizeof(EvtSurvey::ssid)) ssidLen = sizeof(EvtSurvey::ssid);
+        size_t len = offsetof(EvtSurvey, ssid) + ssidLen;
+        if (len + 9 > budget) {                 // + framing (len, kind, dt, crc)
+            surveyCursor = i;                   // Resume here next period
+            return;
+        }
+        budget -= len + 9;
+
+        EvtSurvey e;
+        memcpy(e.bssid, r.bssid, 6);
+        e.ch = r.ch;
+        e.rssiLast = r.rssiLast;
+        e.rssiEwma = (int8_t)(r.ewma / 256);
+        e.rssiMin = r.rssiMin;
+        e.rssiMax = r.rssiMax;
+        e.samples = r.samples;
+        memcpy(e.ssid, r.ssid, ssidLen);
+        append(EVT_SURVEY, timeOf(nowMs), &e, len);
+
+        if (!m) {
+            m = victim;                         // Free slot, else the longest unlogged AP
+            memcpy(m->bssid, r.bssid, 6);
+        }
+        m->ch = r.ch;
+        m->ewma = ewma;
+        m->loggedAt = nowMs ? nowMs : 1;
+    }
+    surveyCursor = 0;
+}
+
+// --- READERS ---
+
+uint64_t EventStore::now() const {
+    return timeOf(millis());
+}
+
+size_t EventStore::query(uint64_t from, uint64_t to, size_t limit, EventVisitor visit, void* ctx) {
+    if (!part || !visit || limit == 0 || from > to) return 0;
+
+    // 1. Index snapshot: overlapping segments in write order
+    struct Span { uint64_t first; uint32_t seq; uint16_t used; int16_t seg; };
+    Span spans[EVT_MAX_SEGMENTS];
+    size_t count = 0;
+    if (xSemaphoreTake(mutex, portMAX_DELAY)) {
+        for (int s = 0; s < segCount; s++) {
+            const EvtSegIndex& e = index[s];
+            if (e.state == SegState::FREE || e.used == 0) continue;
+            if (e.firstTime > to || e.lastTime < from) continue;
+            Span sp = { e.firstTime, e.seq, e.used, (int16_t)s };
+            size_t j = count++;
+            while (j > 0 && spans[j - 1].seq > sp.seq) { spans[j] = spans[j - 1]; j--; }
+            spans[j] = sp;
+        }
+        xSemaphoreGive(mutex);
+    }
+
+    // 2. Walk only those segments (flushed bytes only)
+    // visit() streams to a client, so StorageCore may recycle a segment mid-walk.
+    // openSegment() drops the index entry before the first erase: a record decoded
+    // while the entry still holds our seq came from the old data and is safe to emit.
+    size_t emitted = 0;
+    EventRecord rec;
+    for (size_t i = 0; i < count; i++) {
+        if (!segmentIs(spans[i].seg, spans[i].seq)) continue;   // Recycled meanwhile
+
+        SegReader reader(part, segOffset(spans[i].seg) + EVT_HEADER_SIZE, spans[i].used);
+        uint64_t time = spans[i].first;
+        uint32_t off = 0;
+        while (off < spans[i].used) {
+            size_t avail;
+            const uint8_t* p = reader.at(off, avail);
+            int n = decodeRecord(p, avail, time, &rec);
+            if (!segmentIs(spans[i].seg, spans[i].seq)) break;    // Erased / rewritten under us
+            if (n == 0) break;
+            if (n < 0) { corrupt++; break; }
+            off += (uint32_t)n;
+            if (rec.time > to) return emitted;   // Time only grows along the log
+            if (rec.time < from) continue;
+            if (!visit(rec, ctx)) return emitted;
+            if (++emitted >= limit) return emitted;
+        }
+    }
+    return emitted;
+}
+
+bool EventStore::segmentIs(int seg, uint32_t seq) {
+    bool same = false;
+    if (xSemaphoreTake(mutex, portMAX_DELAY)) {
+        same = (index[seg].seq == seq && index[seg].state != SegState::FREE);
+        xSemaphoreGive(mutex);
+    }
+    return same;
+}
+
+EventStoreStats EventStore::getStats() {
+    EventStoreStats st;
+    memset(&st, 0, sizeof(st));
+    st.mounted = (part != nullptr);
+    st.segments = segCount;
+    st.capacity = (uint32_t)segCount * dataCapacity();
+    st.corrupt = corrupt;
+    st.flushes = flushes;
+    st.eraseMin = UINT32_MAX;
+    bool any = false;
+
+    if (xSemaphoreTake(mutex, portMAX_DELAY)) {
+        for (int s = 0; s < segCount; s++) {
+            const EvtSegIndex& e = index[s];
+            if (e.eraseCount < st.eraseMin) st.eraseMin = e.eraseCount;
+            if (e.eraseCount > st.eraseMax) st.eraseMax = e.eraseCount;
+            if (e.state == SegState::SEALED) st.sealed++;
+            if (e.state == SegState::FREE || e.records == 0) continue;
+            st.records += e.records;
+            st.bytesUsed += e.used;
+            if (!any || e.firstTime < st.oldest) st.oldest = e.firstTime;
+            if (e.lastTime > st.newest) st.newest = e.lastTime;
+            any = true;
+        }
+        xSemaphoreGive(mutex);
+    }
+    if (segCount == 0) st.eraseMin = 0;
+    return st;
+}
+
+const char* EventStore::kindName(uint8_t kind) {
+    switch (kind) {
+        case EVT_BOOT:            return "boot";
+        case EVT_DEAUTH_SPOOF:    return "deauth_spoof";
+        case EVT_BLE_FLOOD:       return "ble_flood";
+        case EVT_RF_INTERFERENCE: return "rf_interference";
+        case EVT_SURVEY:          return "survey";
+        case EVT_CRASH:           return "crash";
+        case EVT_ALERT:           return "alert";
+        default:                  return "unknown";
+    }
+}
+
+// {"t":<log ms>,"k":"<kind>", ...kind fields}
+size_t EventStore::formatJson(const EventRecord& r, char* out, size_t cap) {
+    if (!out || cap == 0) return 0;
+    int n = snprintf(out, cap, "{\"t\":%llu,\"k\":\"%s\"", (unsigned long long)r.time, kindName(r.kind));
+    if (n < 0 || (size_t)n >= cap) return 0;
+    char* p = out + n;
+    size_t left = cap - n;
+    int m = 0;
+
+    switch (r.kind) {
+        case EVT_BOOT: {
+            if (r.len < sizeof(EvtBoot)) break;
+            m = snprintf(p, left, ",\"reason\":%u", (unsigned)r.data[0]);
+            break;
+        }
+        case EVT_DEAUTH_SPOOF: {
+            if (r.len < sizeof(EvtDeauthSpoof)) break;
+            EvtDeauthSpoof e;
+            memcpy(&e, r.data, sizeof(e));
+            m = snprintf(p, left, ",\"bssid\":\"%02X:%02X:%02X:%02X:%02X:%02X\",\"why\":\"%s\",\"rssi\":%d",
+                         e.bssid[0], e.bssid[1], e.bssid[2], e.bssid[3], e.bssid[4], e.bssid[5],
+                         e.why ? "rssi" : "seq", (int)e.rssi);
+            break;
+        }
+        case EVT_BLE_FLOOD: {
+            if (r.len < sizeof(EvtBleFlood)) break;
+            EvtBleFlood e;
+            memcpy(&e, r.data, sizeof(e));
+            m = snprintf(p, left, ",\"vendor\":\"%s\",\"id\":%u,\"rate\":%u,\"addrs\":%u,\"rssi\":%d",
+                         BleFloodGuard::vendorName(e.vendor, e.flags), (unsigned)e.vendor,
+                         (unsigned)e.rate, (unsigned)e.addresses, (int)e.rssi);
+            break;
+        }
+        case EVT_RF_INTERFERENCE: {
+            if (r.len < sizeof(EvtRfInterference)) break;
+            EvtRfInterference e;
+            memcpy(&e, r.data, sizeof(e));
+            m = snprintf(p, left, ",\"mask\":%u,\"peak\":%u", (unsigned)e.channelMask, (unsigned)e.peakEnergy);
+            break;
+        }
+        case EVT_SURVEY: {
+            if (r.len < offsetof(EvtSurvey, ssid)) break;
+            EvtSurvey e;
+            memset(&e, 0, sizeof(e));
+            memcpy(&e, r.data, (r.len < sizeof(e)) ? r.len : sizeof(e));
+            char ssid[33] = {0};
+            size_t ssidLen = r.len - offsetof(EvtSurvey, ssid);
+            for (size_t i = 0; i < ssidLen && i < 32; i++) {
+                char c = e.ssid[i];
+                ssid[i] = (c < 32 || c > 126 || c == '"' || c == '\\') ? '?' : c;
+            }
+            m = snprintf(p, left, ",\"bssid\":\"%02X:%02X:%02X:%02X:%02X:%02X\",\"ssid\":\"%s\",\"ch\":%u,"
+                         "\"last\":%d,\"ewma\":%d,\"min\":%d,\"max\":%d,\"n\":%u",
+                         e.bssid[0], e.bssid[1], e.bssid[2], e.bssid[3], e.bssid[4], e.bssid[5], ssid,
+                         (unsigned)e.ch, (int)e.rssiLast, (int)e.rssiEwma, (int)e.rssiMin, (int)e.rssiMax,
+                         (unsigned)e.samples);
+            break;
+        }
+        case EVT_CRASH: {
+            if (r.len < sizeof(EvtCrash)) break;
+            EvtCrash e;
+            memcpy(&e, r.data, sizeof(e));
+            char task[sizeof(e.task) + 1] = {0};
+            for (size_t i = 0; i < sizeof(e.task) && e.task[i]; i++) {
+                char c = e.task[i];
+                task[i] = (c < 32 || c > 126 || c == '"' || c == '\\') ? '?' : c;
+            }
+            m = snprintf(p, left, ",\"task\":\"%s\",\"pc\":\"0x%08lx\",\"cause\":%lu,\"mtval\":\"0x%08lx\",\"ra\":\"0x%08lx\"",
+                         task, (unsigned long)e.pc, (unsigned long)e.cause, (unsigned long)e.tval, (unsigned long)e.ra);
+            break;
+        }
+        case EVT_ALERT: {
+            if (r.len < sizeof(EvtAlert)) break;
+            EvtAlert e;
+            memcpy(&e, r.data, sizeof(e));
+            // Rule keys are looked up in this build's table (logs are read back by the same firmware)
+            const char* key = (e.rule < AlertEngine::ruleCount()) ? AlertEngine::rule(e.rule).key : "?";
+            m = snprintf(p, left, ",\"rule\":\"%s\",\"open\":%s,\"value\":%u,\"peak\":%u,\"ch\":%u,"
+                         "\"bssid\":\"%02X:%02X:%02X:%02X:%02X:%02X\"",
+                         key, e.raised ? "true" : "false", (unsigned)e.value, (unsigned)e.peak, (unsigned)e.ch,
+                         e.bssid[0], e.bssid[1], e.bssid[2], e.bssid[3], e.bssid[4], e.bssid[5]);
+            break;
+        }
+        default:
+            break;
+    }
+    if (m < 0 || (size_t)m >= left) m = 0;
+    n += m;
+    if ((size_t)n + 1 < cap) {
+        out[n++] = '}';
+        out[n] = '\0';
+    }
+    return (size_t)n;
+}
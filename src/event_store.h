@@ -0,0 +1,201 @@
+/*
+ * ======================================================================================
+ * FILE: event_store.h
+ * DESCRIPTION: Append-only event log on the `spiffs` data partition (raw esp_partition,
+ *              no filesystem). Fixed-size segments of CRC-framed, delta-timed records,
+ *              rotated oldest-first, with a per-segment time index kept in RAM.
+ * ======================================================================================
+ */
+
+#pragma once
+
+#include "config.h"
+#include "bus.h"
+#include <esp_partition.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <cstdint>
+#include <cstddef>
+
+// Segment layout:  [header 32 B][records ...][0xFF ...][footer 32 B]
+// Record framing:  [len][kind][dt varint][payload][crc16]   len = kind + dt + payload
+//                  dt = ms since the previous record (first: since the header base time)
+#define EVT_HEADER_SIZE    32
+#define EVT_FOOTER_SIZE    32
+#define EVT_MAX_PAYLOAD    62        // Command.text carries [len][payload]
+#define EVT_MAX_RECORD     (1 + 1 + 5 + EVT_MAX_PAYLOAD + 2)
+
+enum EventKind : uint8_t {
+    EVT_BOOT = 1,            // EvtBoot
+    EVT_DEAUTH_SPOOF,        // EvtDeauthSpoof
+    EVT_BLE_FLOOD,           // EvtBleFlood
+    EVT_RF_INTERFERENCE,     // EvtRfInterference
+    EVT_SURVEY,              // EvtSurvey (SSID truncated to its length)
+    EVT_CRASH,               // EvtCrash (new coredump found at boot)
+    EVT_ALERT,               // EvtAlert (alert rule opened / closed)
+    EVT_KIND_COUNT
+};
+
+// --- PAYLOADS (little-endian, packed; stored as-is) ---
+struct __attribute__((packed)) EvtBoot {
+    uint8_t resetReason;     // esp_reset_reason_t
+};
+
+struct __attribute__((packed)) EvtDeauthSpoof {
+    uint8_t bssid[6];
+    uint8_t why;             // 0 = sequence, 1 = RSSI
+    int8_t  rssi;
+};
+
+struct __attribute__((packed)) EvtBleFlood {
+    uint16_t vendor;
+    uint8_t  flags;          // BLE_SRC_* | BLE_ADDR_RANDOM
+    uint8_t  rate;           // Adverts/s (decayed)
+    uint8_t  addresses;      // Distinct addresses in the window
+    int8_t   rssi;
+};
+
+struct __attribute__((packed)) EvtRfInterference {
+    uint16_t channelMask;    // Bit k = WiFi channel k+1 judged RF_NON_WIFI
+    uint8_t  peakEnergy;     // Highest energy % among them
+};
+
+struct __attribute__((packed)) EvtSurvey {
+    uint8_t bssid[6];
+    uint8_t ch;
+    int8_t  rssiLast;
+    int8_t  rssiEwma;
+    int8_t  rssiMin;
+    int8_t  rssiMax;
+    uint16_t samples;
+    char    ssid[32];        // Not terminated: record length bounds it
+};
+
+struct __attribute__((packed)) EvtCrash {
+    char     task[16];       // Terminated (copied from the coredump summary)
+    uint32_t pc;
+    uint32_t cause;          // RISC-V mcause
+    uint32_t tval;           // mtval
+    uint32_t ra;
+};
+
+struct __attribute__((packed)) EvtAlert {
+    uint8_t  rule;           // Index into the alert rule table (alert_engine.cpp)
+    uint8_t  raised;         // 1 = opened, 0 = closed
+    uint16_t value;          // Metric value at the transition
+    uint16_t peak;           // Highest value while open
+    uint8_t  ch;             // 0 = n/a
+    uint8_t  bssid[6];       // Zero = n/a
+};
+
+static_assert(sizeof(EvtSurvey) <= EVT_MAX_PAYLOAD, "[CFG-CRITICAL] EvtSurvey exceeds EVT_MAX_PAYLOAD.");
+
+// Decoded record (copy-out)
+struct EventRecord {
+    uint64_t time;           // Log clock, ms
+    uint8_t  kind;
+    uint8_t  len;            // Payload bytes
+    uint8_t  data[EVT_MAX_PAYLOAD];
+};
+
+// Return false to stop the walk
+typedef bool (*EventVisitor)(const EventRecord& rec, void* ctx);
+
+enum class SegState : uint8_t { FREE, ACTIVE, SEALED };
+
+// RAM time index: one entry per segment
+struct EvtSegIndex {
+    uint64_t firstTime;
+    uint64_t lastTime;
+    uint32_t seq;            // Monotonic; 0 = never written
+    uint32_t eraseCount;
+    uint16_t records;
+    uint16_t used;           // Flushed bytes after the header
+    SegState state;
+};
+
+struct EventStoreStats {
+    bool     mounted;
+    uint16_t segments;
+    uint16_t sealed;
+    uint32_t records;
+    uint32_t bytesUsed;
+    uint32_t capacity;
+    uint32_t eraseMin;
+    uint32_t eraseMax;
+    uint32_t corrupt;        // Records rejected by CRC / framing
+    uint32_t flushes;
+    uint64_t oldest;
+    uint64_t newest;
+};
+
+class EventStore {
+public:
+    static EventStore& getInstance();
+    EventStore(const EventStore&) = delete;
+    void operator=(const EventStore&) = delete;
+
+    // setup(): locate the partition, rebuild the index, log the boot
+    bool mount();
+    bool isMounted() const { return part != nullptr; }
+
+    // Producers (any task): non-blocking post to StorageCore, dropped when full
+    static bool post(EventKind kind, const void* payload, size_t len);
+
+    // StorageCore task only
+    void handleCommand(const Command& cmd);
+    void tick();                          // Flush staged records, survey snapshot
+    void flush();
+
+    // Readers (any task). Walks only segments whose index overlaps [from, to].
+    size_t query(uint64_t from, uint64_t to, size_t limit, EventVisitor visit, void* ctx);
+    EventStoreStats getStats();
+
+    // Log clock: ms, monotonic across reboots (gaps between boots are collapsed)
+    uint64_t now() const;
+    uint64_t timeOf(uint32_t millisStamp) const { return clockBase + millisStamp; }
+
+    static size_t formatJson(const EventRecord& r, char* out, size_t cap);
+    static const char* kindName(uint8_t kind);
+
+private:
+    EventStore();
+
+    const esp_partition_t* part;
+    SemaphoreHandle_t mutex;
+    EvtSegIndex index[EVT_MAX_SEGMENTS];
+    uint16_t segCount;
+    int16_t active;                       // -1 = none open
+    uint32_t nextSeq;
+    uint64_t clockBase;
+    uint64_t prevTime;                    // Last appended record (delta base)
+
+    uint8_t staged[EVT_WRITE_BUF];
+    uint16_t stagedLen;
+    uint32_t stagedAt;                    // millis() of the oldest staged record
+
+    uint32_t corrupt;
+    uint32_t flushes;
+    uint32_t lastSurveyMs;
+
+    // Last logged state per AP: snapshots skip APs that have not changed materially
+    struct SurveyMark {
+        uint8_t  bssid[6];
+        uint8_t  ch;
+        int8_t   ewma;
+        uint32_t loggedAt;                // millis(), 0 = free
+    };
+    SurveyMark surveyMarks[SURVEY_MAX_APS];
+    size_t surveyCursor;                  // Round-robin start (budget fairness)
+
+    void append(uint8_t kind, uint64_t time, const void* payload, size_t len);
+    bool openSegment(uint64_t baseTime);
+    void sealActive();
+    int pickSegment() const;
+    bool scanSegment(int seg);
+    bool segmentIs(int seg, uint32_t seq);  // Index still holds this segment generation (readers)
+    void snapshotSurvey(uint32_t nowMs);
+
+    uint32_t segOffset(int seg) const { return (uint32_t)seg * EVT_SEGMENT_SIZE; }
+    static constexpr uint32_t dataCapacity() { return EVT_SEGMENT_SIZE - EVT_HEADER_SIZE - EVT_FOOTER_SIZE; }
+};
@@ -0,0 +1,255 @@
+/*
+ * ======================================================================================
+ * FILE: frame_view.h
+ * DESCRIPTION: Zero-copy, bounds-checked view over a raw 802.11 frame (promiscuous
+ *              buffer or a copy of it). Frame control, addresses, sequence control,
+ *              tagged information elements and the beacon security fingerprint; a
+ *              truncated frame reads as "absent",
+ *              never out of bounds. Header-only; header accessors are C++11 constexpr
+ *              (self-checked below), the element walk is a runtime loop.
+ * ======================================================================================
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+// --- LAYOUT (management header, IEEE 802.11-2020 9.3.3) ---
+constexpr size_t DOT11_FC          = 0;
+constexpr size_t DOT11_ADDR1       = 4;     // Receiver / DA
+constexpr size_t DOT11_ADDR2       = 10;    // Transmitter / SA
+constexpr size_t DOT11_ADDR3       = 16;    // BSSID (management frames)
+constexpr size_t DOT11_SEQ_CTRL    = 22;
+constexpr size_t DOT11_MGMT_HDR    = 24;
+constexpr size_t DOT11_BEACON_BODY = 12;    // Timestamp 8 + interval 2 + capability 2
+constexpr size_t DOT11_FCS         = 4;     // Trailing CRC counted in the radio's sig_len
+constexpr uint16_t DOT11_CAP_PRIVACY = 0x0010;  // Capability info: WEP/WPA/RSN required
+
+enum class FrameType : uint8_t { MGMT = 0, CTRL = 1, DATA = 2, EXT = 3 };
+
+enum MgmtSubtype : uint8_t {
+    MGMT_ASSOC_REQ  = 0,
+    MGMT_ASSOC_RESP = 1,
+    MGMT_PROBE_REQ  = 4,
+    MGMT_PROBE_RESP = 5,
+    MGMT_BEACON     = 8,
+    MGMT_DISASSOC   = 10,
+    MGMT_AUTH       = 11,
+    MGMT_DEAUTH     = 12,
+    MGMT_ACTION     = 13
+};
+
+enum ElementId : uint8_t {
+    IE_SSID       = 0,
+    IE_RATES      = 1,
+    IE_DS_PARAMS  = 3,      // Current channel
+    IE_RSN        = 48,
+    IE_VENDOR     = 221
+};
+
+// Security fingerprint of a beacon / probe response (FrameView::securityMask).
+// Suite classes as set bits: independent of vendor IE order, 0 = not known.
+enum SecurityBits : uint16_t {
+    SEC_KNOWN     = 0x8000,   // Set on every computed mask
+    SEC_PRIVACY   = 0x0001,   // Capability privacy bit
+    SEC_RSN       = 0x0002,   // RSN element present
+    SEC_TKIP      = 0x0010,   // Pairwise / group ciphers
+    SEC_CCMP      = 0x0020,
+    SEC_GCMP      = 0x0040,
+    SEC_CIPHER_X  = 0x0080,   // Any other cipher suite
+    SEC_AKM_EAP   = 0x0100,   // 802.1X (incl. SHA-256)
+    SEC_AKM_PSK   = 0x0200,   // PSK (incl. SHA-256)
+    SEC_AKM_SAE   = 0x0400,   // WPA3-Personal
+    SEC_AKM_OWE   = 0x0800,   // Enhanced Open
+    SEC_AKM_X     = 0x1000    // Any other AKM
+};
+
+// Frame control word (little-endian on air)
+struct FrameControl {
+    uint16_t raw;
+
+    constexpr explicit FrameControl(uint16_t r) : raw(r) {}
+
+    constexpr uint8_t protocol() const { return (uint8_t)(raw & 0x03); }
+    constexpr FrameType type() const { return (FrameType)((raw >> 2) & 0x03); }
+    constexpr uint8_t subtype() const { return (uint8_t)((raw >> 4) & 0x0F); }
+    constexpr bool toDs() const { return raw & 0x0100; }
+    constexpr bool fromDs() const { return raw & 0x0200; }
+    constexpr bool retry() const { return raw & 0x0800; }
+    constexpr bool isProtected() const { return raw & 0x4000; }
+
+    constexpr bool isMgmt(uint8_t sub) const {
+        return protocol() == 0 && type() == FrameType::MGMT && subtype() == sub;
+    }
+    constexpr bool isDeauthOrDisassoc() const { return isMgmt(MGMT_DEAUTH) || isMgmt(MGMT_DISASSOC); }
+
+    // First on-air byte of a management frame (builders)
+    static constexpr uint8_t mgmtByte(uint8_t sub) { return (uint8_t)(sub << 4); }
+};
+
+// One tagged element. `data == nullptr`: not present or truncated.
+struct InfoElement {
+    uint8_t id;
+    uint8_t len;
+    const uint8_t* data;
+
+    constexpr bool present() const { return data != nullptr; }
+};
+
+class FrameView {
+public:
+    // `len` = bytes actually readable (callers strip the FCS)
+    constexpr FrameView(const uint8_t* buf, size_t len) : p(buf), n(buf ? len : 0) {}
+
+    constexpr size_t size() const { return n; }
+    constexpr const uint8_t* data() const { return p; }
+    constexpr bool has(size_t off, size_t len) const { return len <= n && off <= n - len; }
+
+    // Too short for a frame control: reads as protocol 3 / EXT, matches nothing
+    constexpr FrameControl fc() const {
+        return FrameControl(has(DOT11_FC, 2) ? le16(DOT11_FC) : (uint16_t)0xFFFF);
+    }
+    constexpr bool hasMgmtHeader() const { return fc().type() == FrameType::MGMT && has(0, DOT11_MGMT_HDR); }
+
+    // Addresses: nullptr when the frame is cut before them
+    constexpr const uint8_t* addr1() const { return field(DOT11_ADDR1, 6); }
+    constexpr const uint8_t* addr2() const { return field(DOT11_ADDR2, 6); }
+    constexpr const uint8_t* addr3() const { return field(DOT11_ADDR3, 6); }
+
+    // Sequence control: 12-bit sequence number, 4-bit fragment number
+    constexpr bool hasSeq() const { return has(DOT11_SEQ_CTRL, 2); }
+    constexpr uint16_t seq() const { return hasSeq() ? (uint16_t)(le16(DOT11_SEQ_CTRL) >> 4) : 0; }
+    constexpr uint8_t fragment() const { return hasSeq() ? (uint8_t)(p[DOT11_SEQ_CTRL] & 0x0F) : 0; }
+
+    // Deauth / disassoc reason code (first body field)
+    constexpr uint16_t reason() const { return has(DOT11_MGMT_HDR, 2) ? le16(DOT11_MGMT_HDR) : 0; }
+
+    // Capability information of a beacon / probe response, 0 for other frames
+    constexpr uint16_t capability() const {
+        return (elementsOffset() == DOT11_MGMT_HDR + DOT11_BEACON_BODY && has(DOT11_MGMT_HDR + 10, 2))
+             ? le16(DOT11_MGMT_HDR + 10) : 0;
+    }
+
+    // Offset of the tagged elements for the management subtypes that carry them, else 0
+    constexpr size_t elementsOffset() const {
+        return (fc().isMgmt(MGMT_BEACON) || fc().isMgmt(MGMT_PROBE_RESP)) ? DOT11_MGMT_HDR + DOT11_BEACON_BODY
+             : fc().isMgmt(MGMT_PROBE_REQ) ? DOT11_MGMT_HDR
+             : 0;
+    }
+
+    // First element with `id`. A malformed length stops the walk (nothing past it is trusted).
+    // A loop, not C++11 recursive constexpr: element count is attacker-controlled.
+    InfoElement element(uint8_t id) const {
+        size_t off = elementsOffset();
+        if (off == 0) return InfoElement{id, 0, nullptr};
+        while (has(off, 2)) {
+            uint8_t eid = p[off];
+            uint8_t elen = p[off + 1];
+            if (!has(off + 2, elen)) break;
+            if (eid == id) return InfoElement{eid, elen, p + off + 2};
+            off += 2 + (size_t)elen;
+        }
+        return InfoElement{id, 0, nullptr};
+    }
+
+    // Visit every complete element in order; `fn(const InfoElement&)` returns false to stop
+    template <typename Fn>
+    void forEachElement(Fn&& fn) const {
+        size_t off = elementsOffset();
+        if (off == 0) return;
+        while (has(off, 2) && has(off + 2, p[off + 1])) {
+            if (!fn(InfoElement{p[off], p[off + 1], p + off + 2})) return;
+            off += 2 + (size_t)p[off + 1];
+        }
+    }
+
+    // SecurityBits of a beacon / probe response: privacy bit plus the RSN cipher and AKM
+    // classes. A truncated RSN element keeps the suites parsed so far. 0 for other frames.
+    uint16_t securityMask() const {
+        if (elementsOffset() != DOT11_MGMT_HDR + DOT11_BEACON_BODY) return 0;
+        uint16_t mask = SEC_KNOWN;
+        if (capability() & DOT11_CAP_PRIVACY) mask |= SEC_PRIVACY;
+
+        InfoElement rsn = element(IE_RSN);
+        if (!rsn.present()) return mask;
+        mask |= SEC_RSN;
+
+        // Version 2, group cipher 4, pairwise count 2 + 4n, AKM count 2 + 4m
+        size_t off = 2;
+        if (off + 4 <= rsn.len) { mask |= cipherBit(rsn.data + off); off += 4; }
+        for (int list = 0; list < 2 && off + 2 <= rsn.len; list++) {
+            size_t count = (size_t)(rsn.data[off] | (rsn.data[off + 1] << 8));
+            off += 2;
+            for (size_t i = 0; i < count && off + 4 <= rsn.len; i++, off += 4) {
+                mask |= (list == 0) ? cipherBit(rsn.data + off) : akmBit(rsn.data + off);
+            }
+        }
+        return mask;
+    }
+
+    // Bytes up to the end of element `id` (a snapshot that keeps it), 0 if absent
+    constexpr size_t endOf(const InfoElement& e) const {
+        return e.present() ? (size_t)(e.data - p) + e.len : 0;
+    }
+
+private:
+    const uint8_t* p;
+    size_t n;
+
+    constexpr uint16_t le16(size_t off) const { return (uint16_t)(p[off] | (p[off + 1] << 8)); }
+    constexpr const uint8_t* field(size_t off, size_t len) const { return has(off, len) ? p + off : nullptr; }
+
+    // RSN suite selector (OUI 00-0F-AC + type) -> SecurityBits
+    static constexpr bool ieee80211Suite(const uint8_t* s) { return s[0] == 0x00 && s[1] == 0x0F && s[2] == 0xAC; }
+    static constexpr uint16_t cipherBit(const uint8_t* s) {
+        return !ieee80211Suite(s) ? (uint16_t)SEC_CIPHER_X
+             : s[3] == 2 ? (uint16_t)SEC_TKIP
+             : (s[3] == 4 || s[3] == 10) ? (uint16_t)SEC_CCMP
+             : (s[3] == 8 || s[3] == 9) ? (uint16_t)SEC_GCMP
+             : (uint16_t)SEC_CIPHER_X;
+    }
+    static constexpr uint16_t akmBit(const uint8_t* s) {
+        return !ieee80211Suite(s) ? (uint16_t)SEC_AKM_X
+             : (s[3] == 1 || s[3] == 5) ? (uint16_t)SEC_AKM_EAP
+             : (s[3] == 2 || s[3] == 6) ? (uint16_t)SEC_AKM_PSK
+             : (s[3] == 8 || s[3] == 24) ? (uint16_t)SEC_AKM_SAE
+             : s[3] == 18 ? (uint16_t)SEC_AKM_OWE
+             : (uint16_t)SEC_AKM_X;
+    }
+};
+
+// --- SELF-CHECK (header accessors at compile time, element walk at boot) ---
+namespace frame_view_check {
+    // Beacon, SA = BSSID = 02:..:01, seq 0x123, SSID "AB", then a truncated RSN element
+    constexpr uint8_t BEACON[] = {
+        0x80, 0x00, 0x00, 0x00,  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x02, 0x00, 0x00, 0x00, 0x00, 0x01,  0x02, 0x00, 0x00, 0x00, 0x00, 0x01,
+        0x30, 0x12,
+        0, 0, 0, 0, 0, 0, 0, 0,  0x64, 0x00,  0x01, 0x04,
+        IE_SSID, 2, 'A', 'B',
+        IE_RSN, 20, 0x01
+    };
+    constexpr FrameView BEACON_VIEW(BEACON, sizeof(BEACON));
+
+    static_assert(FrameControl::mgmtByte(MGMT_BEACON) == 0x80 && FrameControl::mgmtByte(MGMT_DEAUTH) == 0xC0 &&
+                  FrameControl::mgmtByte(MGMT_DISASSOC) == 0xA0, "802.11 subtype encoding");
+    static_assert(BEACON_VIEW.fc().isMgmt(MGMT_BEACON) && BEACON_VIEW.hasMgmtHeader(), "frame control decode");
+    static_assert(BEACON_VIEW.seq() == 0x123, "sequence control decode");
+    static_assert(BEACON_VIEW.addr3()[5] == 0x01, "address decode");
+    static_assert(BEACON_VIEW.elementsOffset() == DOT11_MGMT_HDR + DOT11_BEACON_BODY, "IE offset");
+    static_assert(BEACON_VIEW.capability() == 0x0401 && !(BEACON_VIEW.capability() & DOT11_CAP_PRIVACY), "capability decode");
+    static_assert(!FrameView(BEACON, 20).hasMgmtHeader() && FrameView(BEACON, 20).addr3() == nullptr &&
+                  !FrameView(BEACON, 20).hasSeq(), "truncated header must read as absent");
+    static_assert(!FrameView(nullptr, 64).fc().isMgmt(MGMT_ASSOC_REQ), "empty view matches nothing");
+
+    // Element walk (AttackEngine::init): false = parser broken, nothing would be classified
+    inline bool run() {
+        InfoElement ssid = BEACON_VIEW.element(IE_SSID);
+        return ssid.len == 2 && ssid.data[1] == 'B' &&
+               BEACON_VIEW.endOf(ssid) == 40 &&
+               !BEACON_VIEW.element(IE_RSN).present() &&
+               BEACON_VIEW.securityMask() == SEC_KNOWN &&
+               !FrameView(BEACON, 20).element(IE_SSID).present();
+    }
+}
@@ -126,13 +126,17 @@ int Hardware::getKey() {
 
 RF24& Hardware::getRadio() { return radio; }
 
+bool Hardware::sampleCarrier(uint8_t channel) {
+    radio.setChannel(channel);
+    radio.startListening();
+    delayMicroseconds(120); 
+    radio.stopListening();
+    return radio.testCarrier();
+}
+
 void Hardware::scanSpectrum(uint8_t (&spectrum)[128]) {
     for(int i=0; i<128; i++) {
-        radio.setChannel(i);
-        radio.startListening();
-        delayMicroseconds(120); 
-        radio.stopListening();
-        if(radio.testCarrier()) {
+        if(sampleCarrier(i)) {
             if(spectrum[i] < 30) spectrum[i] += 2; 
         } else {
             if(spectrum[i] > 0) spectrum[i]--; 
@@ -173,17 +177,38 @@ void Hardware::saveCred(const char* cred) {
         return;
     }
     int count = prefs.getInt("cred_cnt", 0);
-    if(count >= MAX_CREDS) return; 
+    if(count >= (int)MAX_CREDS) return; 
     
     String key = "c" + String(count);
     prefs.putString(key.c_str(), cred);
     prefs.putInt("cred_cnt", count + 1);
 }
 
+bool Hardware::saveCounter(const char* key, uint32_t value) {
+    if (!key) return false;
+    return prefs.putUInt(key, value) == sizeof(uint32_t);
+}
+
+uint32_t Hardware::loadCounter(const char* key, uint32_t fallback) {
+    if (!key) return fallback;
+    return prefs.getUInt(key, fallback);
+}
+
+bool Hardware::saveBlob(const char* key, const void* data, size_t len) {
+    if (!key || !data) return false;
+    return prefs.putBytes(key, data, len) == len;
+}
+
+size_t Hardware::loadBlob(const char* key, void* out, size_t len) {
+    if (!key || !out || !prefs.isKey(key)) return 0;
+    if (prefs.getBytesLength(key) != len) return 0;   // Layout changed: ignore
+    return prefs.getBytes(key, out, len);
+}
+
 std::vector<StoredCred> Hardware::loadCreds() {
     std::vector<StoredCred> creds;
     int count = prefs.getInt("cred_cnt", 0);
-    if (count > MAX_CREDS) count = MAX_CREDS;
+    if (count > (int)MAX_CREDS) count = (int)MAX_CREDS;
 
     for(int i=0; i<count; i++) {
         String key = "c" + String(i);
@@ -198,6 +223,19 @@ std::vector<StoredCred> Hardware::loadCreds() {
     return creds;
 }
 
+void Hardware::handleCommand(const Command& cmd) {
+    switch (cmd.id) {
+        case CommandId::SAVE_CRED:
+            saveCred(cmd.text);
+            break;
+        case CommandId::SAVE_SETTINGS:
+            saveSettings(cmd.bssid, cmd.channel);
+            break;
+        default:
+            break;
+    }
+}
+
 void Hardware::clearCreds() {
     prefs.putInt("cred_cnt", 0);
 }
\ No newline at end of file
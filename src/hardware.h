@@ -9,6 +9,7 @@
 
 #include "config.h"
 #include "types.h" 
+#include "bus.h"
 #include <Wire.h>
 #include <Adafruit_GFX.h>
 #include <Adafruit_SSD1306.h>
@@ -36,6 +37,7 @@ public:
     RF24& getRadio();
 
     void scanSpectrum(uint8_t (&spectrum)[128]);
+    bool sampleCarrier(uint8_t channel);      // One NRF24 bin, ~130 us
     void jamFreq(int channel);
     
     // Status Indicators
@@ -47,8 +49,19 @@ public:
     
     void saveCred(const char* cred);
     
+    // Raw 32-bit counters (diagnostics / benchmark)
+    bool saveCounter(const char* key, uint32_t value);
+    uint32_t loadCounter(const char* key, uint32_t fallback = 0);
+
+    // Fixed-layout structs (health counters)
+    bool saveBlob(const char* key, const void* data, size_t len);
+    size_t loadBlob(const char* key, void* out, size_t len);
+    
     std::vector<StoredCred> loadCreds(); 
     void clearCreds();
+    
+    // Bus entry point (StorageCore task only)
+    void handleCommand(const Command& cmd);
 
 private:
     Hardware();
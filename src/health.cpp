@@ -0,0 +1,278 @@
+/*
+ * ======================================================================================
+ * FILE: health.cpp
+ * DESCRIPTION: Persistent performance counters and coredump summary.
+ *              RTC block: freshest state, survives every reset except power loss.
+ *              NVS mirror: written from StorageCore, rate limited, only when changed.
+ * ======================================================================================
+ */
+
+#include "health.h"
+#include "hardware.h"
+#include "bus.h"
+#include "event_store.h"
+#include <esp_attr.h>
+#include <esp_system.h>
+#include <esp_task_wdt.h>
+#include <esp_rom_crc.h>
+
+#if CONFIG_ESP_COREDUMP_ENABLE_TO_FLASH && CONFIG_ESP_COREDUMP_DATA_FORMAT_ELF
+#include <esp_core_dump.h>
+#define HEALTH_HAS_COREDUMP 1
+#else
+#define HEALTH_HAS_COREDUMP 0
+#endif
+
+#define HEALTH_MAGIC     0x4C564843   // "LVHC"
+#define HEALTH_VERSION   1
+#define HEALTH_NVS_KEY   "health"
+#define HEALTH_CD_KEY    "cd_sig"     // Signature of the last coredump already reported
+
+// Not zeroed by the startup code: holds whatever the previous boot left behind
+RTC_NOINIT_ATTR static HealthCounters rtcCounters;
+
+static bool isValid(const HealthCounters& c) {
+    return c.magic == HEALTH_MAGIC && c.magicInv == (uint32_t)~HEALTH_MAGIC && c.version == HEALTH_VERSION;
+}
+
+HealthMonitor& HealthMonitor::getInstance() {
+    static HealthMonitor instance;
+    return instance;
+}
+
+HealthMonitor::HealthMonitor() : lastPersist(0), reason(0) {
+    memset(&prev, 0, sizeof(prev));
+    memset(&crashInfo, 0, sizeof(crashInfo));
+    memset(&mirror, 0, sizeof(mirror));
+    memset(lastBeatUs, 0, sizeof(lastBeatUs));
+}
+
+HealthCounters& HealthMonitor::rtc() {
+    return rtcCounters;
+}
+
+void HealthMonitor::begin() {
+    HealthCounters& c = rtc();
+    reason = (uint8_t)esp_reset_reason();
+
+    // 1. Warm reset keeps the RTC block; after power loss fall back to the NVS mirror
+    bool warm = isValid(c);
+    if (!warm) {
+        HealthCounters saved;
+        if (Hardware::getInstance().loadBlob(HEALTH_NVS_KEY, &saved, sizeof(saved)) == sizeof(saved) && isValid(saved)) {
+            c = saved;
+        } else {
+            memset(&c, 0, sizeof(c));
+            c.magic = HEALTH_MAGIC;
+            c.version = HEALTH_VERSION;
+            c.magicInv = ~(uint32_t)HEALTH_MAGIC;
+        }
+    }
+
+    // 2. Close the previous boot, open this one
+    prev = c.current;
+    c.boots++;
+    switch (reason) {
+        case ESP_RST_TASK_WDT:
+        case ESP_RST_INT_WDT:
+        case ESP_RST_WDT:      c.wdtResets++; break;
+        case ESP_RST_PANIC:    c.panics++;    break;
+        case ESP_RST_BROWNOUT: c.brownouts++; break;
+        default: break;
+    }
+    memset(&c.current, 0, sizeof(c.current));
+    c.current.minFreeHeap = esp_get_minimum_free_heap_size();
+
+    // 3. Single task still: NVS is safe here, and the boot count survives an early crash
+    persist();
+    decodeCoredump();
+
+    if (ENABLE_SERIAL_LOG) {
+        Serial.printf("[HEALTH] Boot %lu, reset %s (%s RTC). WDT %lu, panic %lu, brownout %lu\n",
+                      (unsigned long)c.boots, resetName(reason), warm ? "warm" : "cold",
+                      (unsigned long)c.wdtResets, (unsigned long)c.panics, (unsigned long)c.brownouts);
+        Serial.printf("[HEALTH] Prev boot: up %lus, worst UI %lums ENG %lums NET %lums, drops %lu, heap min %lu\n",
+                      (unsigned long)prev.uptimeS, (unsigned long)(prev.worstUs(HEALTH_UI) / 1000),
+                      (unsigned long)(prev.worstUs(HEALTH_ENGINE) / 1000), (unsigned long)(prev.worstUs(HEALTH_NET) / 1000),
+                      (unsigned long)prev.busDropped, (unsigned long)prev.minFreeHeap);
+        if (crashInfo.present) {
+            Serial.printf("[HEALTH] Coredump%s: task %s, %s, PC 0x%08lx RA 0x%08lx MTVAL 0x%08lx\n",
+                          crashInfo.fresh ? " (new)" : "", crashInfo.task, causeName(crashInfo.cause),
+                          (unsigned long)crashInfo.pc, (unsigned long)crashInfo.ra, (unsigned long)crashInfo.tval);
+        }
+    }
+}
+
+// Summary only: the full image stays in the partition for espcoredump.py
+void HealthMonitor::decodeCoredump() {
+#if HEALTH_HAS_COREDUMP
+    esp_core_dump_summary_t summary;
+    if (esp_core_dump_get_summary(&summary) != ESP_OK) return;
+
+    crashInfo.present = true;
+    safeStrCopy(crashInfo.task, summary.exc_task, sizeof(crashInfo.task));
+    crashInfo.pc = summary.exc_pc;
+#if CONFIG_IDF_TARGET_ARCH_RISCV
+    crashInfo.cause = summary.ex_info.mcause;
+    crashInfo.tval = summary.ex_info.mtval;
+    crashInfo.ra = summary.ex_info.ra;
+#endif
+
+    // The image survives until the next crash overwrites it: report each one once
+    uint32_t sig = esp_rom_crc32_le(0, (const uint8_t*)&summary.exc_tcb, sizeof(summary.exc_tcb));
+    sig = esp_rom_crc32_le(sig, (const uint8_t*)&summary.exc_pc, sizeof(summary.exc_pc));
+    sig = esp_rom_crc32_le(sig, (const uint8_t*)summary.exc_task, sizeof(summary.exc_task));
+    auto& hw = Hardware::getInstance();
+    crashInfo.fresh = (hw.loadCounter(HEALTH_CD_KEY, 0) != sig) || reason == ESP_RST_PANIC;
+    if (!crashInfo.fresh) return;
+    hw.saveCounter(HEALTH_CD_KEY, sig);
+
+    EvtCrash evt;
+    memcpy(evt.task, crashInfo.task, sizeof(evt.task));
+    evt.pc = crashInfo.pc;
+    evt.cause = crashInfo.cause;
+    evt.tval = crashInfo.tval;
+    evt.ra = crashInfo.ra;
+    EventStore::post(EVT_CRASH, &evt, sizeof(evt));
+#endif
+}
+
+// --- HEARTBEATS ---
+
+void HealthMonitor::beat(HealthTask t) {
+    uint32_t now = micros();
+    uint32_t last = lastBeatUs[t];
+    if (last != 0) {
+        uint32_t gap = now - last;
+        if (gap > rtc().current.worstGapUs[t]) rtc().current.worstGapUs[t] = gap;
+    }
+    lastBeatUs[t] = now ? now : 1;   // 0 = never beaten
+}
+
+void HealthMonitor::feed(HealthTask t) {
+    beat(t);
+    esp_task_wdt_reset();
+}
+
+// --- STORAGECORE ---
+
+void HealthMonitor::tick() {
+    HealthCounters& c = rtc();
+
+    // Gaps still open: a loop that never comes back (WDT reset) leaves its stall here
+    for (int t = 0; t < HEALTH_TASKS; t++) {
+        uint32_t last = lastBeatUs[t];   // Read before micros(): a newer beat can't underflow
+        if (last == 0) continue;
+        uint32_t open = micros() - last;
+        if (open > c.current.stallUs[t]) c.current.stallUs[t] = open;
+    }
+
+    uint32_t drops = 0;
+    auto& bus = MessageBus::getInstance();
+    for (size_t s = 0; s < (size_t)Subsystem::COUNT; s++) drops += bus.getStats((Subsystem)s).dropped;
+    c.dropsTotal += drops - c.current.busDropped;
+    c.current.busDropped = drops;
+    c.current.minFreeHeap = esp_get_minimum_free_heap_size();
+    c.current.uptimeS = millis() / 1000;
+
+    if (millis() - lastPersist < HEALTH_PERSIST_MS) return;
+    HealthCounters cmp = c;
+    cmp.current.uptimeS = mirror.current.uptimeS;   // Uptime alone is not worth a flash write
+    if (memcmp(&cmp, &mirror, sizeof(cmp)) != 0) persist();
+}
+
+void HealthMonitor::persist() {
+    mirror = rtc();
+    lastPersist = millis();
+    if (!Hardware::getInstance().saveBlob(HEALTH_NVS_KEY, &mirror, sizeof(mirror))) {
+        if (ENABLE_SERIAL_LOG) Serial.println("[HEALTH] NVS mirror write failed");
+    }
+}
+
+// --- REPORTING ---
+
+bool HealthMonitor::abnormalReset() const {
+    return reason == ESP_RST_TASK_WDT || reason == ESP_RST_INT_WDT || reason == ESP_RST_WDT ||
+           reason == ESP_RST_PANIC || reason == ESP_RST_BROWNOUT;
+}
+
+const char* HealthMonitor::resetName(uint8_t r) {
+    switch (r) {
+        case ESP_RST_POWERON:   return "POWERON";
+        case ESP_RST_EXT:       return "EXT";
+        case ESP_RST_SW:        return "SW";
+        case ESP_RST_PANIC:     return "PANIC";
+        case ESP_RST_INT_WDT:   return "INT_WDT";
+        case ESP_RST_TASK_WDT:  return "TASK_WDT";
+        case ESP_RST_WDT:       return "RTC_WDT";
+        case ESP_RST_DEEPSLEEP: return "DEEPSLEEP";
+        case ESP_RST_BROWNOUT:  return "BROWNOUT";
+        default:                return "UNKNOWN";
+    }
+}
+
+const char* HealthMonitor::causeName(uint32_t mcause) {
+    if (mcause & 0x80000000UL) return "INTERRUPT";
+    switch (mcause) {
+        case 0:  return "INSN MISALIGNED";
+        case 1:  return "INSN FAULT";
+        case 2:  return "ILLEGAL INSN";
+        case 3:  return "BREAKPOINT";
+        case 4:  return "LOAD MISALIGNED";
+        case 5:  return "LOAD FAULT";
+        case 6:  return "STORE MISALIGNED";
+        case 7:  return "STORE FAULT";
+        case 8:
+        case 11: return "ECALL";
+        default: return "EXCEPTION";
+    }
+}
+
+const char* HealthMonitor::taskName(int t) {
+    switch (t) {
+        case HEALTH_UI:     return "ui";
+        case HEALTH_ENGINE: return "engine";
+        case HEALTH_NET:    return "net";
+        default:            return "?";
+    }
+}
+
+static int formatBoot(const HealthBoot& b, char* out, size_t cap) {
+    return snprintf(out, cap, "{\"uptime_s\":%lu,\"heap_min\":%lu,\"drops\":%lu,"
+                    "\"worst_us\":{\"ui\":%lu,\"engine\":%lu,\"net\":%lu}}",
+                    (unsigned long)b.uptimeS, (unsigned long)b.minFreeHeap, (unsigned long)b.busDropped,
+                    (unsigned long)b.worstUs(HEALTH_UI), (unsigned long)b.worstUs(HEALTH_ENGINE),
+                    (unsigned long)b.worstUs(HEALTH_NET));
+}
+
+size_t HealthMonitor::formatJson(char* out, size_t cap) const {
+    const HealthCounters& c = rtc();
+    size_t n = 0;
+    int m = snprintf(out, cap, "{\"reset\":\"%s\",\"boots\":%lu,\"wdt\":%lu,\"panics\":%lu,\"brownouts\":%lu,"
+                     "\"drops_total\":%lu,\"current\":",
+                     resetName(reason), (unsigned long)c.boots, (unsigned long)c.wdtResets, (unsigned long)c.panics,
+                     (unsigned long)c.brownouts, (unsigned long)c.dropsTotal);
+    if (m < 0 || (size_t)m >= cap) return 0;
+    n += m;
+
+    m = formatBoot(c.current, out + n, cap - n);
+    if (m < 0 || (size_t)m >= cap - n) return 0;
+    n += m;
+    m = snprintf(out + n, cap - n, ",\"previous\":");
+    if (m < 0 || (size_t)m >= cap - n) return 0;
+    n += m;
+    m = formatBoot(prev, out + n, cap - n);
+    if (m < 0 || (size_t)m >= cap - n) return 0;
+    n += m;
+
+    if (crashInfo.present) {
+        m = snprintf(out + n, cap - n, ",\"coredump\":{\"task\":\"%s\",\"cause\":\"%s\",\"pc\":\"0x%08lx\","
+                     "\"ra\":\"0x%08lx\",\"mtval\":\"0x%08lx\",\"new\":%s}}",
+                     crashInfo.task, causeName(crashInfo.cause), (unsigned long)crashInfo.pc,
+                     (unsigned long)crashInfo.ra, (unsigned long)crashInfo.tval, crashInfo.fresh ? "true" : "false");
+    } else {
+        m = snprintf(out + n, cap - n, ",\"coredump\":null}");
+    }
+    if (m < 0 || (size_t)m >= cap - n) return 0;
+    return n + m;
+}
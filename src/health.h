@@ -0,0 +1,99 @@
+/*
+ * ======================================================================================
+ * FILE: health.h
+ * DESCRIPTION: Field diagnostics. Persistent performance counters kept in RTC memory
+ *              (survive panic / watchdog / software resets) and mirrored to NVS (survive
+ *              power loss), plus a decoded summary of the last coredump.
+ * ======================================================================================
+ */
+
+#pragma once
+
+#include "config.h"
+#include <cstdint>
+#include <cstddef>
+
+// Loops whose latency is tracked. Watchdog-subscribed loops call feed(), others beat().
+enum HealthTask : uint8_t {
+    HEALTH_UI,               // Arduino loop (UI), task WDT
+    HEALTH_ENGINE,           // AttackCore, task WDT
+    HEALTH_NET,              // NetCore (not subscribed: web handlers may wait on the engine)
+    HEALTH_TASKS
+};
+
+// One boot's worth of counters
+struct HealthBoot {
+    uint32_t worstGapUs[HEALTH_TASKS];   // Longest interval between two feeds/beats
+    uint32_t stallUs[HEALTH_TASKS];      // Longest gap still open at a tick (catches the one that tripped the WDT)
+    uint32_t busDropped;                 // Commands dropped on full queues, all subsystems
+    uint32_t minFreeHeap;
+    uint32_t uptimeS;
+
+    uint32_t worstUs(int t) const { return (stallUs[t] > worstGapUs[t]) ? stallUs[t] : worstGapUs[t]; }
+};
+
+// RTC_NOINIT layout (also the NVS blob). Every field has a single writer; no lock.
+struct HealthCounters {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t boots;
+    uint32_t wdtResets;                  // Task / interrupt / RTC watchdog
+    uint32_t panics;
+    uint32_t brownouts;
+    uint32_t dropsTotal;                 // Lifetime bus drops
+    HealthBoot current;
+    uint32_t magicInv;                   // ~magic: torn or uninitialised RTC memory fails the check
+};
+
+// Decoded at boot from the `coredump` partition (when enabled in sdkconfig)
+struct CrashSummary {
+    bool     present;
+    bool     fresh;                      // Not seen by a previous boot
+    char     task[16];
+    uint32_t pc;
+    uint32_t cause;                      // RISC-V mcause
+    uint32_t tval;                       // mtval (faulting address / instruction)
+    uint32_t ra;
+};
+
+class HealthMonitor {
+public:
+    static HealthMonitor& getInstance();
+    HealthMonitor(const HealthMonitor&) = delete;
+    void operator=(const HealthMonitor&) = delete;
+
+    // setup(), after Hardware (NVS) and MessageBus: restore counters, decode the coredump
+    void begin();
+
+    // Loop heartbeats (owning task only). feed() also resets the task watchdog.
+    void feed(HealthTask t);
+    void beat(HealthTask t);
+
+    // StorageCore task only: sample heap/bus, mirror to NVS every HEALTH_PERSIST_MS
+    void tick();
+
+    const HealthCounters& counters() const { return rtc(); }
+    const HealthBoot& previous() const { return prev; }
+    const CrashSummary& crash() const { return crashInfo; }
+    uint8_t resetReason() const { return reason; }
+    bool abnormalReset() const;
+
+    size_t formatJson(char* out, size_t cap) const;
+    static const char* resetName(uint8_t reason);
+    static const char* causeName(uint32_t mcause);
+    static const char* taskName(int t);
+
+private:
+    HealthMonitor();
+
+    static HealthCounters& rtc();
+    void decodeCoredump();
+    void persist();
+
+    HealthBoot prev;
+    CrashSummary crashInfo;
+    HealthCounters mirror;               // Last NVS write (skip unchanged blobs)
+    uint32_t lastBeatUs[HEALTH_TASKS];   // micros(): only differences are used
+    uint32_t lastPersist;
+    uint8_t  reason;
+};
@@ -11,19 +11,65 @@
 #include "attacks.h"
 #include "ui.h"
 #include "web_interface.h"
+#include "bus.h"
+#include "mem_budget.h"
+#include "event_store.h"
+#include "health.h"
+#include "alert_engine.h"
 #include "nvs_flash.h" 
 
 // --- GLOBALS ---
 TaskHandle_t attackTaskHandle = NULL;
+TaskHandle_t netTaskHandle = NULL;
+TaskHandle_t storageTaskHandle = NULL;
 
 // --- TASKS ---
 void attackTask(void *parameter) {
+    auto& bus = MessageBus::getInstance();
+    Command cmd;
+    // A stuck attack/detector loop resets the device like a stuck UI does
+    esp_task_wdt_add(NULL);
     for(;;) {
+        while (bus.receive(Subsystem::ENGINE, cmd, 0)) {
+            AttackEngine::getInstance().handleCommand(cmd);
+            bus.markHandled(Subsystem::ENGINE, cmd);
+        }
         AttackEngine::getInstance().runLoop();
+        AlertEngine::getInstance().tick(millis());
+        HealthMonitor::getInstance().feed(HEALTH_ENGINE);
         vTaskDelay(10 / portTICK_PERIOD_MS);
     }
 }
 
+void netTask(void *parameter) {
+    auto& bus = MessageBus::getInstance();
+    Command cmd;
+    for(;;) {
+        while (bus.receive(Subsystem::WEB, cmd, 0)) {
+            WebInterface::getInstance().handleCommand(cmd);
+            bus.markHandled(Subsystem::WEB, cmd);
+        }
+        WebInterface::getInstance().update();
+        HealthMonitor::getInstance().beat(HEALTH_NET);
+        vTaskDelay(2 / portTICK_PERIOD_MS);
+    }
+}
+
+void storageTask(void *parameter) {
+    auto& bus = MessageBus::getInstance();
+    Command cmd;
+    for(;;) {
+        // NVS and flash writes are slow (page erase): nobody else waits on them
+        if (bus.receive(Subsystem::STORAGE, cmd, pdMS_TO_TICKS(1000))) {
+            if (cmd.id == CommandId::LOG_EVENT) EventStore::getInstance().handleCommand(cmd);
+            else Hardware::getInstance().handleCommand(cmd);
+            bus.markHandled(Subsystem::STORAGE, cmd);
+        }
+        EventStore::getInstance().tick();
+        HealthMonitor::getInstance().tick();
+    }
+}
+
 void setup() {
     // 0. Serial Init
     Serial.begin(115200);
@@ -39,6 +85,12 @@ void setup() {
     ESP_ERROR_CHECK(ret);
     Serial.println("nvs_flash initialized.");
 
+    // 1b. Static RAM breakdown for the compiled profile (checked at build time)
+    MemBudget::report();
+
+    // 1c. Event log (raw `spiffs` partition): rebuild the time index, log the boot
+    EventStore::getInstance().mount();
+
     // 2. Initialize Hardware HAL
     Hardware::getInstance().init();
 
@@ -56,38 +108,49 @@ void setup() {
     // ----------------------------------------------
 
     // 3. Initialize Engines
+    MessageBus::getInstance().init();
+
+    // 3b. Persistent counters + coredump summary (needs NVS and the bus)
+    HealthMonitor::getInstance().begin();
+
     AttackEngine::getInstance().init();
     
     UI::getInstance().init();
     
-    // 4. Create Attack Task
+    // 4. Arm the watchdog (before the tasks: AttackCore subscribes itself)
+    Serial.println("[WDT] Arming Watchdog System...");
+    esp_task_wdt_init(WATCHDOG_TIMEOUT_MS / 1000, true); 
+
+    // 5. Create Subsystem Tasks
     BaseType_t result = xTaskCreate(
         attackTask, "AttackCore", ATTACK_TASK_STACK, NULL, ATTACK_TASK_PRIO, &attackTaskHandle 
     );
+    if (result == pdPASS) {
+        result = xTaskCreate(netTask, "NetCore", NET_TASK_STACK, NULL, NET_TASK_PRIO, &netTaskHandle);
+    }
+    if (result == pdPASS) {
+        result = xTaskCreate(storageTask, "StorageCore", STORAGE_TASK_STACK, NULL, STORAGE_TASK_PRIO, &storageTaskHandle);
+    }
 
-    if (result != pdPASS || attackTaskHandle == NULL) {
+    if (result != pdPASS || attackTaskHandle == NULL || netTaskHandle == NULL || storageTaskHandle == NULL) {
         while(1) {
             digitalWrite(3, HIGH); delay(100);
             digitalWrite(3, LOW);  delay(100);
         }
     }
-    
-    // arm the watchdog
-  
-    Serial.println("[WDT] Arming Watchdog System...");
-    esp_task_wdt_init(WATCHDOG_TIMEOUT_MS / 1000, true); 
+
+    // Loop task (UI) joins once the system is up
     esp_task_wdt_add(NULL); 
     
     if (ENABLE_SERIAL_LOG) Serial.println("[BOOT] Leviathan OS v 0.2.0 alpha (RTOS OK)");
 }
 
 void loop() {
-    // Main loop handles UI and Web 
+    // Main loop handles UI only; Web runs in NetCore
     UI::getInstance().update();
-    WebInterface::getInstance().update();
     
-    // Feed the dog (Reset timer)
-    esp_task_wdt_reset(); 
+    // Feed the dog (Reset timer) and record the loop latency
+    HealthMonitor::getInstance().feed(HEALTH_UI);
     
     vTaskDelay(5 / portTICK_PERIOD_MS);
 }
\ No newline at end of file
@@ -0,0 +1,115 @@
+/*
+ * ======================================================================================
+ * FILE: mem_budget.cpp
+ * DESCRIPTION: Compile-time RAM accounting. Every statically owned buffer is sized
+ *              here from the real types; a profile that does not fit fails the build.
+ * ======================================================================================
+ */
+
+#include "mem_budget.h"
+#include "attacks.h"
+#include "survey.h"
+#include "rf_timeline.h"
+#include "bus.h"
+#include "benchmark.h"
+#include "scan_cache.h"
+#include "event_store.h"
+#include "health.h"
+#include "alert_engine.h"
+#include "hardware.h"
+#include "ui.h"
+#include "web_interface.h"
+
+// --- MODULE FOOTPRINTS (bytes) ---
+
+// AttackEngine members broken out, plus buffers it owns outside the object
+constexpr uint32_t MEM_LOGS      = 3 * sizeof(SeqLock<LogRing>);
+constexpr uint32_t MEM_PKT_QUEUE = PACKET_QUEUE_LEN * sizeof(PacketMsg);                              // Allocated once at boot
+constexpr uint32_t MEM_DEAUTH    = sizeof(DeauthGuard);
+constexpr uint32_t MEM_BLE       = sizeof(BleFloodGuard) + BLE_QUEUE_LEN * sizeof(BleAdvRecord) + sizeof(StaticQueue_t);
+constexpr uint32_t MEM_ENGINE    = sizeof(AttackEngine) - MEM_LOGS - sizeof(DeauthGuard) - sizeof(BleFloodGuard);
+
+constexpr uint32_t MEM_SCAN      = sizeof(ScanCache) + MAX_SCAN_RESULTS * sizeof(APInfo);       // + runScan() sweep
+constexpr uint32_t MEM_SURVEY    = sizeof(SiteSurvey);
+constexpr uint32_t MEM_TIMELINE  = sizeof(RfTimeline);
+constexpr uint32_t MEM_BUS       = sizeof(MessageBus)
+                                   + (BUS_DEPTH_ENGINE + BUS_DEPTH_STORAGE + BUS_DEPTH_WEB + BUS_DEPTH_UI) * sizeof(Command)
+                                   + (size_t)Subsystem::COUNT * sizeof(StaticQueue_t);
+constexpr uint32_t MEM_UI        = sizeof(UI);
+constexpr uint32_t MEM_WEB       = sizeof(WebInterface);
+constexpr uint32_t MEM_HARDWARE  = sizeof(Hardware);
+constexpr uint32_t MEM_EVENTS    = sizeof(EventStore);                                              // Time index + write staging
+constexpr uint32_t MEM_HEALTH    = sizeof(HealthMonitor);                                           // Counters themselves live in RTC RAM
+constexpr uint32_t MEM_ALERTS    = sizeof(AlertEngine);                                             // Windows + transition history
+constexpr uint32_t MEM_BENCH     = sizeof(Benchmark) + sizeof(DeauthGuard)                           // Private guard
+                                   + sizeof(wifi_promiscuous_pkt_t) + 96                               // Synthetic frame
+                                   + sizeof(PacketMsg) + sizeof(StaticQueue_t);                        // Private queue
+constexpr uint32_t MEM_STACKS    = ATTACK_TASK_STACK + NET_TASK_STACK + STORAGE_TASK_STACK + LOOP_TASK_STACK;
+
+constexpr uint32_t MEM_DETECT    = MEM_DEAUTH + MEM_BLE + MEM_SURVEY + MEM_TIMELINE;
+constexpr uint32_t MEM_TOTAL     = MEM_ENGINE + MEM_LOGS + MEM_SCAN + MEM_PKT_QUEUE + MEM_DETECT
+                                   + MEM_BUS + MEM_UI + MEM_WEB + MEM_HARDWARE + MEM_EVENTS + MEM_HEALTH + MEM_ALERTS
+                                   + MEM_BENCH + MEM_STACKS;
+
+// --- BUDGET CHECKS (active profile) ---
+static_assert(MEM_DETECT <= Profile::detectBudget,
+              "[MEM-CRITICAL] Detection tables exceed Profile::detectBudget. Shrink guard/survey/BLE/timeline sizes.");
+static_assert(MEM_TOTAL <= Profile::ramBudget,
+              "[MEM-CRITICAL] Static RAM exceeds Profile::ramBudget. See MemBudget breakdown.");
+static_assert(MEM_LOGS <= Profile::ramBudget / 4,
+              "[MEM-CRITICAL] Log rings take more than a quarter of the profile budget.");
+
+static const MemModule MODULES[] = {
+    { "engine",       MEM_ENGINE },
+    { "engine.logs",  MEM_LOGS },
+    { "engine.pktq",  MEM_PKT_QUEUE },
+    { "scan_cache",   MEM_SCAN },
+    { "deauth_guard", MEM_DEAUTH },
+    { "ble_guard",    MEM_BLE },
+    { "survey",       MEM_SURVEY },
+    { "timeline",     MEM_TIMELINE },
+    { "bus",          MEM_BUS },
+    { "ui",           MEM_UI },
+    { "web",          MEM_WEB },
+    { "hardware",     MEM_HARDWARE },
+    { "events",       MEM_EVENTS },
+    { "health",       MEM_HEALTH },
+    { "alerts",       MEM_ALERTS },
+    { "bench",        MEM_BENCH },
+    { "stacks",       MEM_STACKS },
+};
+
+size_t MemBudget::count() {
+    return sizeof(MODULES) / sizeof(MODULES[0]);
+}
+
+const MemModule& MemBudget::module(size_t index) {
+    return MODULES[(index < count()) ? index : 0];
+}
+
+uint32_t MemBudget::total() { return MEM_TOTAL; }
+uint32_t MemBudget::detectTotal() { return MEM_DETECT; }
+
+void MemBudget::report() {
+    if (!ENABLE_SERIAL_LOG) return;
+    Serial.printf("[MEM] Profile %s: %lu / %lu B static (detect %lu / %lu B)\n", Profile::name,
+                  (unsigned long)MEM_TOTAL, (unsigned long)Profile::ramBudget,
+                  (unsigned long)MEM_DETECT, (unsigned long)Profile::detectBudget);
+    for (const auto& m : MODULES) {
+        Serial.printf("[MEM]   %-13s %6lu B\n", m.name, (unsigned long)m.bytes);
+    }
+}
+
+size_t MemBudget::formatJson(char* out, size_t cap) {
+    if (!out || cap == 0) return 0;
+    int n = snprintf(out, cap, "{\"profile\":\"%s\",\"total\":%lu,\"budget\":%lu,\"detect\":%lu,\"detect_budget\":%lu,\"modules\":{",
+                     Profile::name, (unsigned long)MEM_TOTAL, (unsigned long)Profile::ramBudget,
+                     (unsigned long)MEM_DETECT, (unsigned long)Profile::detectBudget);
+    for (size_t i = 0; i < count() && n > 0 && (size_t)n < cap; i++) {
+        n += snprintf(out + n, cap - n, "%s\"%s\":%lu", (i > 0) ? "," : "",
+                      MODULES[i].name, (unsigned long)MODULES[i].bytes);
+    }
+    if (n > 0 && (size_t)n < cap) n += snprintf(out + n, cap - n, "}}");
+    if (n < 0) return 0;
+    return ((size_t)n < cap) ? (size_t)n : cap - 1;
+}
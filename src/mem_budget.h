@@ -0,0 +1,32 @@
+/*
+ * ======================================================================================
+ * FILE: mem_budget.h
+ * DESCRIPTION: Per-module static RAM breakdown for the active resource profile.
+ *              Figures are computed by the compiler and checked against the profile
+ *              budget at build time (see mem_budget.cpp).
+ * ======================================================================================
+ */
+
+#pragma once
+
+#include "config.h"
+#include <cstdint>
+#include <cstddef>
+
+struct MemModule {
+    const char* name;
+    uint32_t bytes;
+};
+
+class MemBudget {
+public:
+    static size_t count();
+    static const MemModule& module(size_t index);
+
+    static uint32_t total();
+    static uint32_t detectTotal();   // Guard + survey + BLE + timeline
+
+    // Boot report (Serial) and telemetry
+    static void report();
+    static size_t formatJson(char* out, size_t cap);
+};
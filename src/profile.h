@@ -0,0 +1,130 @@
+/*
+ * ======================================================================================
+ * FILE: profile.h
+ * DESCRIPTION: Compile-time resource profiles. Every profile-dependent size lives in one
+ *              constexpr type; all profiles are validated on every build, not only the
+ *              selected one.
+ * ======================================================================================
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#define PROFILE_STEALTH     0
+#define PROFILE_PERFORMANCE 1
+#define PROFILE_MONITOR     2   // Lean, long-running passive monitor
+
+template <int Id> struct ResourceProfile;
+
+template <> struct ResourceProfile<PROFILE_PERFORMANCE> {
+    static constexpr const char* name = "PERFORMANCE";
+
+    // Buffers
+    static constexpr size_t maxInputLen      = 128;
+    static constexpr size_t maxLogs          = 100;
+    static constexpr size_t maxCreds         = 50;
+    static constexpr size_t maxScanResults   = 50;
+    static constexpr size_t maxWebClients    = 4;
+
+    // Passive detection tables
+    static constexpr size_t guardMaxBssids   = 32;
+    static constexpr size_t surveyMaxAps     = 64;
+    static constexpr size_t blePatternSlots  = 64;
+    static constexpr size_t bleDedupSlots    = 256;
+    static constexpr size_t rfTimelineSlots  = 60;      // 2 min of history
+
+    // Queues
+    static constexpr size_t packetQueueLen   = 32;
+    static constexpr size_t bleQueueLen      = 64;
+
+    // Task stacks (bytes)
+    static constexpr uint32_t attackTaskStack  = 8192;
+    static constexpr uint32_t netTaskStack     = 6144;
+    static constexpr uint32_t storageTaskStack = 4096;
+
+    // Static RAM the firmware may claim (module state + queues + task stacks)
+    static constexpr uint32_t ramBudget      = 96 * 1024;
+    static constexpr uint32_t detectBudget   = 24 * 1024;   // Guard + survey + BLE + timeline
+};
+
+template <> struct ResourceProfile<PROFILE_STEALTH> {
+    static constexpr const char* name = "STEALTH";
+
+    static constexpr size_t maxInputLen      = 64;
+    static constexpr size_t maxLogs          = 20;
+    static constexpr size_t maxCreds         = 10;
+    static constexpr size_t maxScanResults   = 15;
+    static constexpr size_t maxWebClients    = 1;
+
+    static constexpr size_t guardMaxBssids   = 8;
+    static constexpr size_t surveyMaxAps     = 16;
+    static constexpr size_t blePatternSlots  = 16;
+    static constexpr size_t bleDedupSlots    = 64;
+    static constexpr size_t rfTimelineSlots  = 16;
+
+    static constexpr size_t packetQueueLen   = 32;
+    static constexpr size_t bleQueueLen      = 32;
+
+    static constexpr uint32_t attackTaskStack  = 8192;
+    static constexpr uint32_t netTaskStack     = 6144;
+    static constexpr uint32_t storageTaskStack = 4096;
+
+    static constexpr uint32_t ramBudget      = 64 * 1024;
+    static constexpr uint32_t detectBudget   = 8 * 1024;
+};
+
+// Detection-first: full guard/BLE/timeline coverage, minimal offensive buffers
+// and tighter stacks (no TLS, no evil-twin credential churn).
+template <> struct ResourceProfile<PROFILE_MONITOR> {
+    static constexpr const char* name = "MONITOR";
+
+    static constexpr size_t maxInputLen      = 64;
+    static constexpr size_t maxLogs          = 16;
+    static constexpr size_t maxCreds         = 4;
+    static constexpr size_t maxScanResults   = 10;
+    static constexpr size_t maxWebClients    = 1;
+
+    static constexpr size_t guardMaxBssids   = 24;
+    static constexpr size_t surveyMaxAps     = 32;
+    static constexpr size_t blePatternSlots  = 32;
+    static constexpr size_t bleDedupSlots    = 128;
+    static constexpr size_t rfTimelineSlots  = 30;
+
+    static constexpr size_t packetQueueLen   = 16;
+    static constexpr size_t bleQueueLen      = 32;
+
+    static constexpr uint32_t attackTaskStack  = 6144;
+    static constexpr uint32_t netTaskStack     = 4096;
+    static constexpr uint32_t storageTaskStack = 3072;
+
+    static constexpr uint32_t ramBudget      = 48 * 1024;
+    static constexpr uint32_t detectBudget   = 12 * 1024;
+};
+
+// --- PROFILE VALIDATION (all profiles, every build) ---
+
+constexpr bool isPow2(size_t v) { return v != 0 && (v & (v - 1)) == 0; }
+
+template <typename P>
+constexpr bool stacksSafe() {
+    return P::attackTaskStack >= 4096 && P::netTaskStack >= 4096 && P::storageTaskStack >= 3072;
+}
+
+template <typename P>
+constexpr bool tablesValid() {
+    return isPow2(P::blePatternSlots) && isPow2(P::bleDedupSlots) &&
+           P::maxLogs > 0 && P::maxScanResults > 0 && P::guardMaxBssids > 0 &&
+           P::surveyMaxAps > 0 && P::rfTimelineSlots > 0 && P::maxInputLen >= 32;
+}
+
+static_assert(stacksSafe<ResourceProfile<PROFILE_PERFORMANCE>>() &&
+              stacksSafe<ResourceProfile<PROFILE_STEALTH>>() &&
+              stacksSafe<ResourceProfile<PROFILE_MONITOR>>(),
+              "[MEM-CRITICAL] Task stack below the safe minimum (4 KB attack/net, 3 KB storage) in a profile.");
+
+static_assert(tablesValid<ResourceProfile<PROFILE_PERFORMANCE>>() &&
+              tablesValid<ResourceProfile<PROFILE_STEALTH>>() &&
+              tablesValid<ResourceProfile<PROFILE_MONITOR>>(),
+              "[CFG-CRITICAL] Invalid table size in a profile (BLE tables must be powers of two).");
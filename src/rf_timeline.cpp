@@ -0,0 +1,215 @@
+/*
+ * ======================================================================================
+ * FILE: rf_timeline.cpp
+ * DESCRIPTION: Timeline builder. Runs inside the AttackCore task; each tick is bounded
+ *              so the single core keeps time for the WiFi stack and the UI.
+ * ======================================================================================
+ */
+
+#include "rf_timeline.h"
+#include "hardware.h"
+#include "event_store.h"
+#include "esp_wifi.h"
+#include <esp_timer.h>
+#include <cstring>
+
+volatile uint32_t RfTimeline::frameCounters[RF_WIFI_CHANNELS] = {0};
+
+// WiFi channel k is centred on 2407 + 5k MHz and spans +/-11 MHz
+static inline bool channelCovers(int k, int nrfChannel) {
+    int offset = nrfChannel - (7 + 5 * k);
+    return offset >= -11 && offset <= 11;
+}
+
+RfTimeline& RfTimeline::getInstance() {
+    static RfTimeline instance;
+    return instance;
+}
+
+RfTimeline::RfTimeline() {
+    reset();
+}
+
+uint32_t RfTimeline::clockMs() {
+    return (uint32_t)(esp_timer_get_time() / 1000);
+}
+
+void RfTimeline::reset() {
+    for (int k = 0; k < RF_WIFI_CHANNELS; k++) frameBase[k] = frameCounters[k];
+    memset(frames, 0, sizeof(frames));
+    memset(dwell, 0, sizeof(dwell));
+    memset(hits, 0, sizeof(hits));
+    memset(samples, 0, sizeof(samples));
+    memset(spectrum, 0, sizeof(spectrum));
+    slotStartMs = clockMs();
+    lastTickMs = slotStartMs;
+    sweeps = 0;
+    sweepPos = 0;
+    lastInterference = 0;
+
+    data.write([](RfTimelineData& d) {
+        d.head = 0;
+        d.count = 0;
+        d.generation = 0;
+        memset(d.spectrum, 0, sizeof(d.spectrum));
+    });
+}
+
+void RfTimeline::tick() {
+    uint32_t now = clockMs();
+    uint32_t elapsed = now - lastTickMs;
+    lastTickMs = now;
+
+    // 1. WiFi: dwell goes to the tuned channel, frames to the channel they were received on
+    uint8_t primary = 0;
+    wifi_second_chan_t second;
+    if (esp_wifi_get_channel(&primary, &second) == ESP_OK && primary >= 1 && primary <= RF_WIFI_CHANNELS) {
+        dwell[primary - 1] += elapsed;
+    }
+    for (int k = 0; k < RF_WIFI_CHANNELS; k++) {
+        uint32_t c = frameCounters[k];
+        frames[k] += c - frameBase[k];
+        frameBase[k] = c;
+    }
+
+    // 2. NRF24: a slice of the sweep per pass (full band every ~11 passes)
+    auto& hw = Hardware::getInstance();
+    for (int i = 0; i < RF_SWEEP_CHUNK; i++) {
+        int nrf = RF_NRF_FIRST + sweepPos;
+        bool carrier = hw.sampleCarrier((uint8_t)nrf);
+
+        uint8_t& level = spectrum[sweepPos];
+        if (carrier) { if (level < 30) level += 2; }
+        else if (level > 0) level--;
+
+        // Credit every WiFi channel whose span overlaps this bin
+        for (int k = 0; k < RF_WIFI_CHANNELS; k++) {
+            if (!channelCovers(k + 1, nrf)) continue;
+            if (samples[k] < 0xFFFF) samples[k]++;
+            if (carrier && hits[k] < 0xFFFF) hits[k]++;
+        }
+
+        if (++sweepPos >= RF_NRF_BINS) {
+            sweepPos = 0;
+            if (sweeps < 0xFFFF) sweeps++;
+        }
+    }
+    data.write([&](RfTimelineData& d) { memcpy(d.spectrum, spectrum, sizeof(spectrum)); });
+
+    // 3. Slot roll-over on the shared clock
+    if (now - slotStartMs >= RF_SLOT_MS) closeSlot(now);
+}
+
+void RfTimeline::closeSlot(uint32_t now) {
+    RfSlot s;
+    s.startMs = slotStartMs;
+    s.durationMs = (uint16_t)((now - slotStartMs > 0xFFFF) ? 0xFFFF : now - slotStartMs);
+    s.sweeps = sweeps;
+
+    for (int k = 0; k < RF_WIFI_CHANNELS; k++) {
+        s.ch[k].frames = (uint16_t)((frames[k] > 0xFFFF) ? 0xFFFF : frames[k]);
+        s.ch[k].dwellMs = (uint16_t)((dwell[k] > 0xFFFF) ? 0xFFFF : dwell[k]);
+        s.ch[k].energy = samples[k] ? (uint8_t)((uint32_t)hits[k] * 100 / samples[k]) : 0;
+    }
+
+    // Overlapping channels (+/-4) leak WiFi energy into each other, so busy
+    // energy only counts as interference when no nearby channel carries traffic.
+    for (int k = 0; k < RF_WIFI_CHANNELS; k++) {
+        uint16_t nearFps = 0;
+        for (int j = k - 4; j <= k + 4; j++) {
+            if (j < 0 || j >= RF_WIFI_CHANNELS) continue;
+            uint16_t f = s.ch[j].fps();
+            if (f > nearFps) nearFps = f;
+        }
+        if (s.ch[k].fps() >= RF_WIFI_BUSY_FPS) s.ch[k].verdict = RF_WIFI;
+        else if (s.ch[k].energy < RF_ENERGY_BUSY_PCT) s.ch[k].verdict = RF_QUIET;
+        else s.ch[k].verdict = (nearFps >= RF_WIFI_BUSY_FPS) ? RF_WIFI : RF_NON_WIFI;
+    }
+
+    // Logged on change only: a steady interferer is one event (and one when it clears)
+    EvtRfInterference evt = { 0, 0 };
+    for (int k = 0; k < RF_WIFI_CHANNELS; k++) {
+        if (s.ch[k].verdict != RF_NON_WIFI) continue;
+        evt.channelMask |= (uint16_t)(1u << k);
+        if (s.ch[k].energy > evt.peakEnergy) evt.peakEnergy = s.ch[k].energy;
+    }
+    if (evt.channelMask != lastInterference) {
+        if (EventStore::post(EVT_RF_INTERFERENCE, &evt, sizeof(evt))) lastInterference = evt.channelMask;
+    }
+
+    data.write([&](RfTimelineData& d) {
+        d.slots[d.head] = s;
+        d.head = (d.head + 1) % RF_TIMELINE_SLOTS;
+        if (d.count < RF_TIMELINE_SLOTS) d.count++;
+        d.generation++;
+    });
+
+    memset(frames, 0, sizeof(frames));
+    memset(dwell, 0, sizeof(dwell));
+    memset(hits, 0, sizeof(hits));
+    memset(samples, 0, sizeof(samples));
+    sweeps = 0;
+    slotStartMs = now;
+}
+
+size_t RfTimeline::count() const {
+    uint16_t n = 0;
+    data.read([&](const RfTimelineData& d) { n = d.count; });
+    return n;
+}
+
+uint32_t RfTimeline::generation() const {
+    uint32_t gen = 0;
+    data.read([&](const RfTimelineData& d) { gen = d.generation; });
+    return gen;
+}
+
+// Addressed by generation so a reader walking the ring never skips or repeats
+// a slot when the writer closes one mid-walk
+bool RfTimeline::getSlot(uint32_t gen, RfSlot& out) const {
+    bool found = false;
+    bool ok = data.read([&](const RfTimelineData& d) {
+        uint32_t back = d.generation - gen;     // 0 = newest
+        found = (gen != 0) && (gen <= d.generation) && (back < d.count);
+        if (found) out = d.slots[(d.head + RF_TIMELINE_SLOTS - 1 - back) % RF_TIMELINE_SLOTS];
+    });
+    return ok && found;
+}
+
+bool RfTimeline::getLatest(RfSlot& out) const {
+    bool found = false;
+    bool ok = data.read([&](const RfTimelineData& d) {
+        found = d.count > 0;
+        if (found) out = d.slots[(d.head + RF_TIMELINE_SLOTS - 1) % RF_TIMELINE_SLOTS];
+    });
+    return ok && found;
+}
+
+bool RfTimeline::getSpectrum(uint8_t (&out)[RF_NRF_BINS]) const {
+    return data.read([&](const RfTimelineData& d) { memcpy(out, d.spectrum, sizeof(out)); });
+}
+
+const char* RfTimeline::verdictName(uint8_t v) {
+    switch (v) {
+        case RF_QUIET:    return "quiet";
+        case RF_WIFI:     return "wifi";
+        case RF_NON_WIFI: return "nonwifi";
+        default:          return "?";
+    }
+}
+
+// {"t":<ms>,"dur":<ms>,"sweeps":n,"ch":[[frames,dwell,fps,energy,"verdict"],...]}
+size_t RfTimeline::formatJson(const RfSlot& s, char* out, size_t cap) {
+    if (!out || cap == 0) return 0;
+    int n = snprintf(out, cap, "{\"t\":%lu,\"dur\":%u,\"sweeps\":%u,\"ch\":[",
+                     (unsigned long)s.startMs, (unsigned)s.durationMs, (unsigned)s.sweeps);
+    for (int k = 0; k < RF_WIFI_CHANNELS && n > 0 && (size_t)n < cap; k++) {
+        const RfChannelSample& c = s.ch[k];
+        n += snprintf(out + n, cap - n, "%s[%u,%u,%u,%u,\"%s\"]", (k > 0) ? "," : "",
+                      (unsigned)c.frames, (unsigned)c.dwellMs, (unsigned)c.fps(),
+                      (unsigned)c.energy, verdictName(c.verdict));
+    }
+    if (n > 0 && (size_t)n < cap) n += snprintf(out + n, cap - n, "]}");
+    if (n < 0) return 0;
+    return ((size_t)n < cap) ? (size_t)n : cap - 1;
+}
@@ -0,0 +1,101 @@
+/*
+ * ======================================================================================
+ * FILE: rf_timeline.h
+ * DESCRIPTION: Correlated 2.4 GHz timeline: WiFi frames per channel and NRF24 carrier
+ *              energy on one clock (esp_timer), in a fixed ring of time slots.
+ * ======================================================================================
+ */
+
+#pragma once
+
+#include "config.h"
+#include "seqlock.h"
+#include <cstdint>
+#include <cstddef>
+
+#define RF_WIFI_CHANNELS  13
+#define RF_NRF_FIRST      1          // NRF24 channel n = 2400 + n MHz
+#define RF_NRF_LAST       83         // 2401..2483 MHz covers WiFi channels 1-13
+#define RF_NRF_BINS       (RF_NRF_LAST - RF_NRF_FIRST + 1)
+
+// Per-channel explanation of the slot
+enum RfVerdict : uint8_t {
+    RF_QUIET,       // Low energy, little traffic
+    RF_WIFI,        // Energy explained by decoded 802.11 traffic (here or overlapping)
+    RF_NON_WIFI     // Carrier energy with no matching WiFi traffic: interference
+};
+
+struct RfChannelSample {
+    uint16_t frames;      // 802.11 frames decoded on this channel
+    uint16_t dwellMs;     // Time the WiFi radio was tuned here
+    uint8_t  energy;      // NRF24 carrier occupancy over the 22 MHz channel, %
+    uint8_t  verdict;     // RfVerdict
+
+    uint16_t fps() const { return dwellMs ? (uint16_t)((uint32_t)frames * 1000 / dwellMs) : 0; }
+};
+
+struct RfSlot {
+    uint32_t startMs;     // esp_timer ms since boot (shared by both sources)
+    uint16_t durationMs;
+    uint16_t sweeps;      // Complete NRF24 passes over the WiFi band
+    RfChannelSample ch[RF_WIFI_CHANNELS];
+};
+
+// Published state: closed slots plus the live sweep
+struct RfTimelineData {
+    RfSlot slots[RF_TIMELINE_SLOTS];
+    uint16_t head;                     // Next write slot
+    uint16_t count;
+    uint32_t generation;               // Slots closed since reset
+    uint8_t spectrum[RF_NRF_BINS];     // Live carrier level per bin (0-30, decaying)
+};
+
+class RfTimeline {
+public:
+    static RfTimeline& getInstance();
+    RfTimeline(const RfTimeline&) = delete;
+    void operator=(const RfTimeline&) = delete;
+
+    // Sniffer side (WiFi task): monotonic counters, single writer, no lock
+    static void onFrame(uint8_t channel) {
+        if (channel >= 1 && channel <= RF_WIFI_CHANNELS) frameCounters[channel - 1]++;
+    }
+
+    // Engine task only
+    void reset();
+    void tick();      // Bounded step: WiFi deltas + dwell, RF_SWEEP_CHUNK NRF bins, slot roll-over
+
+    // Readers (lock-free, any task)
+    size_t count() const;
+    uint32_t generation() const;
+    bool getSlot(uint32_t gen, RfSlot& out) const;         // Slot closed as generation `gen` (1-based)
+    bool getLatest(RfSlot& out) const;
+    bool getSpectrum(uint8_t (&out)[RF_NRF_BINS]) const;
+
+    static size_t formatJson(const RfSlot& s, char* out, size_t cap);
+    static const char* verdictName(uint8_t v);
+
+    // Timeline clock (esp_timer, ms since boot)
+    static uint32_t clockMs();
+
+private:
+    RfTimeline();
+
+    SeqLock<RfTimelineData> data;
+    static volatile uint32_t frameCounters[RF_WIFI_CHANNELS];
+
+    // Open slot accumulators (engine task only)
+    uint32_t frameBase[RF_WIFI_CHANNELS];
+    uint32_t frames[RF_WIFI_CHANNELS];
+    uint32_t dwell[RF_WIFI_CHANNELS];
+    uint16_t hits[RF_WIFI_CHANNELS];
+    uint16_t samples[RF_WIFI_CHANNELS];
+    uint8_t spectrum[RF_NRF_BINS];
+    uint32_t slotStartMs;
+    uint32_t lastTickMs;
+    uint16_t sweeps;
+    uint8_t sweepPos;
+    uint16_t lastInterference;         // Channel mask last sent to the event log
+
+    void closeSlot(uint32_t now);
+};
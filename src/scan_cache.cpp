@@ -0,0 +1,77 @@
+/*
+ * ======================================================================================
+ * FILE: scan_cache.cpp
+ * DESCRIPTION: Scan cache implementation. Reads copy only what the caller asks for.
+ * ======================================================================================
+ */
+
+#include "scan_cache.h"
+#include <Arduino.h>
+
+ScanCache& ScanCache::getInstance() {
+    static ScanCache instance;
+    return instance;
+}
+
+void ScanCache::publish(const APInfo* aps, size_t count) {
+    if (count > MAX_SCAN_RESULTS) count = MAX_SCAN_RESULTS;
+    uint32_t now = millis();
+    results.write([&](ScanResults& r) {
+        if (aps && count > 0) memcpy(r.aps, aps, count * sizeof(APInfo));
+        r.count = (uint16_t)count;
+        r.generation++;
+        r.completedAt = now;
+    });
+}
+
+size_t ScanCache::read(APInfo* buffer, size_t maxCount, uint32_t* generation) const {
+    if (!buffer || maxCount == 0) return 0;
+    size_t copied = 0;
+    uint32_t gen = 0;
+    bool ok = results.read([&](const ScanResults& r) {
+        copied = (r.count < maxCount) ? r.count : maxCount;
+        memcpy(buffer, r.aps, copied * sizeof(APInfo));
+        gen = r.generation;
+    });
+    if (!ok) return 0;
+    if (generation) *generation = gen;
+    return copied;
+}
+
+bool ScanCache::get(uint32_t generation, size_t index, APInfo& out) const {
+    bool found = false;
+    bool ok = results.read([&](const ScanResults& r) {
+        found = (r.generation == generation) && (index < r.count);
+        if (found) out = r.aps[index];
+    });
+    return ok && found;
+}
+
+size_t ScanCache::count() const {
+    uint16_t n = 0;
+    results.read([&](const ScanResults& r) { n = r.count; });
+    return n;
+}
+
+uint32_t ScanCache::generation() const {
+    uint32_t gen = 0;
+    results.read([&](const ScanResults& r) { gen = r.generation; });
+    return gen;
+}
+
+uint32_t ScanCache::ageMs() const {
+    uint32_t gen = 0, at = 0;
+    results.read([&](const ScanResults& r) { gen = r.generation; at = r.completedAt; });
+    return gen ? millis() - at : UINT32_MAX;
+}
+
+bool ScanCache::isFresh(uint32_t ttlMs) const {
+    return ageMs() < ttlMs;
+}
+
+// Lets the engine coalesce SCAN requests queued behind a sweep that just finished
+bool ScanCache::completedSince(uint32_t sinceMs) const {
+    uint32_t gen = 0, at = 0;
+    results.read([&](const ScanResults& r) { gen = r.generation; at = r.completedAt; });
+    return gen != 0 && (int32_t)(at - sinceMs) >= 0;
+}
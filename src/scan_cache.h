@@ -0,0 +1,49 @@
+/*
+ * ======================================================================================
+ * FILE: scan_cache.h
+ * DESCRIPTION: Shared result cache for WiFi sweeps. One copy in RAM, written by the
+ *              engine task, read lock-free by UI and web (generation + TTL).
+ * ======================================================================================
+ */
+
+#pragma once
+
+#include "config.h"
+#include "types.h"
+#include "seqlock.h"
+#include <cstdint>
+#include <cstddef>
+
+// Last completed sweep
+struct ScanResults {
+    APInfo aps[MAX_SCAN_RESULTS];
+    uint16_t count;
+    uint32_t generation;      // Bumped on every completed scan (0 = never scanned)
+    uint32_t completedAt;     // millis()
+
+    ScanResults() : count(0), generation(0), completedAt(0) {}
+};
+
+class ScanCache {
+public:
+    static ScanCache& getInstance();
+    ScanCache(const ScanCache&) = delete;
+    void operator=(const ScanCache&) = delete;
+
+    // Engine task only
+    void publish(const APInfo* aps, size_t count);
+
+    // Readers (lock-free, any task)
+    size_t read(APInfo* buffer, size_t maxCount, uint32_t* generation = nullptr) const;
+    bool get(uint32_t generation, size_t index, APInfo& out) const;   // False if the sweep was replaced
+    size_t count() const;
+    uint32_t generation() const;
+    uint32_t ageMs() const;                                            // UINT32_MAX if never scanned
+    bool isFresh(uint32_t ttlMs = SCAN_CACHE_TTL_MS) const;
+    bool completedSince(uint32_t sinceMs) const;                       // A sweep finished at/after millis() stamp
+
+private:
+    ScanCache() {}
+
+    SeqLock<ScanResults> results;
+};
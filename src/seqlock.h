@@ -0,0 +1,69 @@
+/*
+ * ======================================================================================
+ * FILE: seqlock.h
+ * DESCRIPTION: Versioned snapshot (sequence lock) for lock-free state publication.
+ * ======================================================================================
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#define SEQLOCK_MAX_RETRIES   8
+
+// Writers must be serialised by the owner (one task, or a short mutex section).
+// Readers never block: they copy the payload and retry if a write overlapped.
+template <typename T>
+class SeqLock {
+public:
+    SeqLock() : seq(0), data() {}
+
+    // --- Writer side ---
+    template <typename Fn>
+    void write(Fn&& fn) {
+        // Plain load/store instead of fetch_add: writers are already serialised
+        // and the C3 (rv32imc) has no native atomic read-modify-write.
+        uint32_t s = seq.load(std::memory_order_relaxed);
+        seq.store(s + 1, std::memory_order_relaxed);         // Odd: write in progress
+        std::atomic_thread_fence(std::memory_order_release);
+        fn(data);
+        std::atomic_thread_fence(std::memory_order_release);
+        seq.store(s + 2, std::memory_order_relaxed);         // Even: stable
+    }
+
+    void store(const T& value) {
+        write([&](T& d) { d = value; });
+    }
+
+    // --- Reader side ---
+    // `fn` must only copy out of the payload. Returns false if the writer
+    // kept overlapping for SEQLOCK_MAX_RETRIES attempts.
+    template <typename Fn>
+    bool read(Fn&& fn) const {
+        for (int i = 0; i < SEQLOCK_MAX_RETRIES; i++) {
+            uint32_t s1 = seq.load(std::memory_order_acquire);
+            if (s1 & 1) {
+                taskYIELD(); // Writer preempted mid-update: let it finish
+                continue;
+            }
+            fn(static_cast<const T&>(data));
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (seq.load(std::memory_order_relaxed) == s1) return true;
+        }
+        return false;
+    }
+
+    bool load(T& out) const {
+        return read([&](const T& d) { out = d; });
+    }
+
+    // Even values only change when the payload changed
+    uint32_t version() const { return seq.load(std::memory_order_acquire); }
+
+private:
+    std::atomic<uint32_t> seq;
+    T data;
+};
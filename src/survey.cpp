@@ -0,0 +1,228 @@
+/*
+ * ======================================================================================
+ * FILE: survey.cpp
+ * DESCRIPTION: Site survey statistics. Fixed table, integer math, mutex-guarded.
+ * ======================================================================================
+ */
+
+#include "survey.h"
+
+static uint16_t isqrt32(uint32_t v) {
+    uint32_t r = 0;
+    uint32_t bit = 1UL << 30;
+    while (bit > v) bit >>= 2;
+    while (bit != 0) {
+        if (v >= r + bit) {
+            v -= r + bit;
+            r = (r >> 1) + bit;
+        } else {
+            r >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (uint16_t)r;
+}
+
+int SurveyRecord::percentile(int p) const {
+    uint32_t total = 0;
+    for (int i = 0; i < SURVEY_HIST_BINS; i++) total += hist[i];
+    if (total == 0) return rssiLast;
+
+    uint32_t target = (total * (uint32_t)p + 99) / 100;
+    if (target == 0) target = 1;
+    uint32_t cum = 0;
+    for (int i = 0; i < SURVEY_HIST_BINS; i++) {
+        cum += hist[i];
+        if (cum >= target) return SURVEY_HIST_FLOOR + i * SURVEY_HIST_STEP + SURVEY_HIST_STEP / 2;
+    }
+    return SURVEY_HIST_FLOOR + SURVEY_HIST_BINS * SURVEY_HIST_STEP;
+}
+
+SiteSurvey& SiteSurvey::getInstance() {
+    static SiteSurvey instance;
+    return instance;
+}
+
+SiteSurvey::SiteSurvey() : used(0), totalSamples(0), rogueMatches(0), rogueCh(0), flaggedCount(0), flaggedNext(0) {
+    mutex = xSemaphoreCreateMutex();
+    memset(table, 0, sizeof(table));
+    memset(rogueBssid, 0, sizeof(rogueBssid));
+    memset(flagged, 0, sizeof(flagged));
+}
+
+void SiteSurvey::clear() {
+    if (xSemaphoreTake(mutex, portMAX_DELAY)) {
+        memset(table, 0, sizeof(table));
+        used = 0;
+        totalSamples = 0;
+        xSemaphoreGive(mutex);
+    }
+}
+
+SurveyRecord* SiteSurvey::findOrClaim(const uint8_t* bssid, uint32_t now) {
+    for (size_t i = 0; i < used; i++) {
+        if (memcmp(table[i].bssid, bssid, 6) == 0) return &table[i];
+    }
+
+    SurveyRecord* slot = nullptr;
+    if (used < SURVEY_MAX_APS) {
+        slot = &table[used++];
+    } else {
+        // [Bounded] Table full: recycle the AP that has been out of range longest
+        slot = &table[0];
+        for (size_t i = 1; i < used; i++) {
+            if ((now - table[i].lastSeen) > (now - slot->lastSeen)) slot = &table[i];
+        }
+    }
+    memset(slot, 0, sizeof(SurveyRecord));
+    memcpy(slot->bssid, bssid, 6);
+    slot->firstSeen = now;
+    return slot;
+}
+
+void SiteSurvey::record(const char* ssid, const uint8_t* bssid, int ch, int rssi, uint32_t now, uint16_t security) {
+    if (!bssid) return;
+    if (rssi < -127) rssi = -127;
+    if (rssi > 0) rssi = 0;
+
+    if (!xSemaphoreTake(mutex, 10)) return;
+
+    SurveyRecord* r = findOrClaim(bssid, now);
+
+    // [Alerts] Fingerprint learned or changed: compare once against the same SSID.
+    // Every later beacon of a flagged BSSID counts, so one odd frame cannot open the alert.
+    if (security != 0) {
+        bool learned = (r->security != security);
+        r->security = security;
+        if (learned) {
+            const SurveyRecord* clone = findClone(r, ssid);
+            if (clone && !isFlagged(clone->bssid)) flag(clone->bssid);
+        }
+        if (isFlagged(bssid)) {
+            rogueMatches++;
+            memcpy(rogueBssid, bssid, 6);
+            rogueCh = (uint8_t)((ch > 0) ? ch : 0);
+        }
+    }
+
+    // Hidden SSIDs never overwrite a name learned from another frame
+    if (ssid && ssid[0] != '\0') safeStrCopy(r->ssid, ssid, sizeof(r->ssid));
+    if (ch > 0) r->ch = (uint8_t)ch;
+
+    if (r->samples == 0) {
+        r->ewma = (int16_t)(rssi * 256);
+        r->var = 0;
+        r->rssiMin = (int8_t)rssi;
+        r->rssiMax = (int8_t)rssi;
+    } else {
+        // 1. EWMA (Q8)
+        int32_t diff = (int32_t)rssi * 256 - r->ewma;
+        r->ewma += (int16_t)(diff >> SURVEY_EWMA_SHIFT);
+
+        // 2. Exponentially weighted variance (Q4)
+        int32_t d4 = diff >> 4;
+        int32_t sq = (d4 * d4) >> 4;
+        int32_t v = (int32_t)r->var + ((sq - (int32_t)r->var) >> SURVEY_EWMA_SHIFT);
+        if (v < 0) v = 0;
+        if (v > 0xFFFF) v = 0xFFFF;
+        r->var = (uint16_t)v;
+
+        // 3. Envelope
+        if (rssi < r->rssiMin) r->rssiMin = (int8_t)rssi;
+        if (rssi > r->rssiMax) r->rssiMax = (int8_t)rssi;
+    }
+
+    // 4. Percentile sketch
+    int bin = (rssi - SURVEY_HIST_FLOOR) / SURVEY_HIST_STEP;
+    if (bin < 0) bin = 0;
+    if (bin >= SURVEY_HIST_BINS) bin = SURVEY_HIST_BINS - 1;
+    if (r->hist[bin] == 0xFF) {
+        for (int i = 0; i < SURVEY_HIST_BINS; i++) r->hist[i] >>= 1;
+    }
+    r->hist[bin]++;
+
+    r->rssiLast = (int8_t)rssi;
+    r->lastSeen = now;
+    if (r->samples < 0xFFFF) r->samples++;
+    totalSamples++;
+
+    xSemaphoreGive(mutex);
+}
+
+// Caller holds `mutex`. Another AP with the same SSID and a different security fingerprint
+// (open or downgraded twin of a protected network, or the reverse): returns the one first
+// seen later, the likelier clone. Multi-AP deployments share one fingerprint and never
+// match, whatever their OUIs; hidden SSIDs and scan-only records (no fingerprint) neither.
+const SurveyRecord* SiteSurvey::findClone(const SurveyRecord* r, const char* ssid) const {
+    if (!ssid || ssid[0] == '\0' || r->security == 0) return nullptr;
+    for (size_t i = 0; i < used; i++) {
+        const SurveyRecord& o = table[i];
+        if (&o == r || o.security == 0 || o.security == r->security) continue;
+        if (strncmp(o.ssid, ssid, sizeof(o.ssid)) != 0) continue;
+        return (o.firstSeen > r->firstSeen) ? &o : r;
+    }
+    return nullptr;
+}
+
+// Caller holds `mutex`
+bool SiteSurvey::isFlagged(const uint8_t* bssid) const {
+    for (size_t i = 0; i < flaggedCount; i++) {
+        if (memcmp(flagged[i], bssid, 6) == 0) return true;
+    }
+    return false;
+}
+
+// Caller holds `mutex`. Full ring: the oldest flag is dropped
+void SiteSurvey::flag(const uint8_t* bssid) {
+    memcpy(flagged[flaggedNext], bssid, 6);
+    flaggedNext = (flaggedNext + 1) % SURVEY_ROGUE_SLOTS;
+    if (flaggedCount < SURVEY_ROGUE_SLOTS) flaggedCount++;
+}
+
+uint32_t SiteSurvey::getRogueMatches(uint8_t* lastBssid, uint8_t* lastCh) {
+    uint32_t n = rogueMatches;
+    if ((lastBssid || lastCh) && xSemaphoreTake(mutex, 10)) {
+        n = rogueMatches;
+        if (lastBssid) memcpy(lastBssid, rogueBssid, 6);
+        if (lastCh) *lastCh = rogueCh;
+        xSemaphoreGive(mutex);
+    }
+    return n;
+}
+
+size_t SiteSurvey::count() {
+    return used;
+}
+
+bool SiteSurvey::getRecord(size_t index, SurveyRecord& out) {
+    bool ok = false;
+    if (xSemaphoreTake(mutex, 10)) {
+        if (index < used) {
+            out = table[index];
+            ok = true;
+        }
+        xSemaphoreGive(mutex);
+    }
+    return ok;
+}
+
+size_t SiteSurvey::formatJson(const SurveyRecord& r, uint32_t now, char* out, size_t cap) {
+    if (!out || cap == 0) return 0;
+
+    // [Safety] SSIDs are attacker-controlled: neutralise JSON metacharacters
+    char ssid[33];
+    jsonSafeCopy(ssid, r.ssid, sizeof(ssid));
+
+    int n = snprintf(out, cap,
+        "{\"s\":\"%s\",\"b\":\"%02X:%02X:%02X:%02X:%02X:%02X\",\"c\":%u,\"n\":%u,"
+        "\"last\":%d,\"avg\":%d,\"sd\":%u,\"min\":%d,\"max\":%d,"
+        "\"p10\":%d,\"p50\":%d,\"p90\":%d,\"t0\":%lu,\"t1\":%lu,\"age\":%lu}",
+        ssid, r.bssid[0], r.bssid[1], r.bssid[2], r.bssid[3], r.bssid[4], r.bssid[5],
+        (unsigned)r.ch, (unsigned)r.samples,
+        (int)r.rssiLast, (int)(r.ewma / 256), (unsigned)(isqrt32(r.var) / 4), (int)r.rssiMin, (int)r.rssiMax,
+        r.percentile(10), r.percentile(50), r.percentile(90),
+        (unsigned long)r.firstSeen, (unsigned long)r.lastSeen, (unsigned long)(now - r.lastSeen));
+
+    if (n < 0) return 0;
+    return ((size_t)n < cap) ? (size_t)n : cap - 1;
+}
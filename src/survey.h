@@ -0,0 +1,76 @@
+/*
+ * ======================================================================================
+ * FILE: survey.h
+ * DESCRIPTION: Long-running per-AP RSSI statistics for site surveys (fixed-point).
+ * ======================================================================================
+ */
+
+#pragma once
+
+#include "config.h"
+#include "types.h"
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <cstdint>
+
+// Packed per-AP record: streaming stats + bucketed percentile sketch
+struct __attribute__((packed)) SurveyRecord {
+    char     ssid[33];
+    uint8_t  bssid[6];
+    uint8_t  ch;
+    int8_t   rssiMin;
+    int8_t   rssiMax;
+    int8_t   rssiLast;
+    int16_t  ewma;                       // Q8 dBm
+    uint16_t var;                        // Q4 dB^2 (exponentially weighted)
+    uint16_t samples;                    // Saturating
+    uint32_t firstSeen;                  // millis()
+    uint32_t lastSeen;                   // millis()
+    uint16_t security;                   // SecurityBits from beacons, 0 = scan only (unknown)
+    uint8_t  hist[SURVEY_HIST_BINS];     // Halved on saturation (ages old data)
+
+    // Approximate percentile (0-100) from the sketch, in dBm
+    int percentile(int p) const;
+};
+
+class SiteSurvey {
+public:
+    static SiteSurvey& getInstance();
+    SiteSurvey(const SiteSurvey&) = delete;
+    void operator=(const SiteSurvey&) = delete;
+
+    // Feed a sample from a passive scan or a beacon (`security`: FrameView::securityMask)
+    void record(const char* ssid, const uint8_t* bssid, int ch, int rssi, uint32_t now, uint16_t security = 0);
+    void clear();
+
+    // Data Access (copy-out, table stays owned by the survey)
+    size_t count();
+    bool getRecord(size_t index, SurveyRecord& out);
+    uint32_t getTotalSamples() const { return totalSamples; }
+
+    // Evil-twin heuristic: beacons from BSSIDs flagged for advertising a known SSID with a
+    // different security fingerprint (counter; last flagged BSSID heard and its channel)
+    uint32_t getRogueMatches(uint8_t* lastBssid, uint8_t* lastCh);
+
+    // JSON export of one record (timestamps relative to `now`)
+    static size_t formatJson(const SurveyRecord& r, uint32_t now, char* out, size_t cap);
+
+private:
+    SiteSurvey();
+
+    SemaphoreHandle_t mutex;
+    SurveyRecord table[SURVEY_MAX_APS];
+    size_t used;
+    uint32_t totalSamples;
+    uint32_t rogueMatches;
+    uint8_t rogueBssid[6];
+    uint8_t rogueCh;
+    uint8_t flagged[SURVEY_ROGUE_SLOTS][6];   // Outlives table eviction and clear()
+    size_t flaggedCount;
+    size_t flaggedNext;
+
+    SurveyRecord* findOrClaim(const uint8_t* bssid, uint32_t now);
+    const SurveyRecord* findClone(const SurveyRecord* r, const char* ssid) const;
+    bool isFlagged(const uint8_t* bssid) const;
+    void flag(const uint8_t* bssid);
+};
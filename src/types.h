@@ -26,6 +26,18 @@ inline void safeStrCopy(char* dest, const char* src, size_t destSize) {
     dest[destSize - 1] = '\0';
 }
 
+// SSIDs are attacker-controlled: copy for a JSON string value with quotes,
+// backslashes and non-printable bytes neutralised to '_'
+inline void jsonSafeCopy(char* dest, const char* src, size_t destSize) {
+    if (!dest || destSize == 0) return;
+    size_t i = 0;
+    for (; src && i < destSize - 1 && src[i] != '\0'; i++) {
+        char c = src[i];
+        dest[i] = (c < 32 || c > 126 || c == '"' || c == '\\') ? '_' : c;
+    }
+    dest[i] = '\0';
+}
+
 // ======================================================================================
 // DATA STRUCTURES
 // ======================================================================================
@@ -45,9 +57,35 @@ enum class AttackType {
     EVIL_TWIN,
     DEAUTH_DETECT,
     RF_SCAN,
-    RF_JAM
+    RF_JAM,
+    SITE_SURVEY,
+    BLE_DETECT,
+    RF_CORRELATE
 };
 
+inline const char* attackTypeName(AttackType t) {
+    switch (t) {
+        case AttackType::NONE:          return "NONE";
+        case AttackType::DEAUTH_TARGET: return "DEAUTH_TARGET";
+        case AttackType::BEACON_LIST:   return "BEACON_LIST";
+        case AttackType::BEACON_RANDOM: return "BEACON_RANDOM";
+        case AttackType::PROBE_SNIFF:   return "PROBE_SNIFF";
+        case AttackType::BLE_SOUR:      return "BLE_SOUR";
+        case AttackType::BLE_SAMS:      return "BLE_SAMS";
+        case AttackType::BLE_WIN:       return "BLE_WIN";
+        case AttackType::BLE_GOOGLE:    return "BLE_GOOGLE";
+        case AttackType::WEB_SERVER:    return "WEB_SERVER";
+        case AttackType::EVIL_TWIN:     return "EVIL_TWIN";
+        case AttackType::DEAUTH_DETECT: return "DEAUTH_DETECT";
+        case AttackType::RF_SCAN:       return "RF_SCAN";
+        case AttackType::RF_JAM:        return "RF_JAM";
+        case AttackType::SITE_SURVEY:   return "SITE_SURVEY";
+        case AttackType::BLE_DETECT:    return "BLE_DETECT";
+        case AttackType::RF_CORRELATE:  return "RF_CORRELATE";
+    }
+    return "UNKNOWN";
+}
+
 //  Credential Container
 struct StoredCred {
     char data[MAX_INPUT_LEN]; 
@@ -60,15 +98,14 @@ struct StoredCred {
     }
 };
 
-// Access Point Structure
+// Access Point Structure (byte-aligned: 41 B, no padding)
 struct APInfo {
     char ssid[33]; 
     uint8_t bssid[6];
-    int rssi;
-    int ch;
-    bool selected;
+    int8_t rssi;       // dBm
+    uint8_t ch;
 
-    APInfo() : rssi(0), ch(0), selected(false) {
+    APInfo() : rssi(0), ch(0) {
         memset(ssid, 0, sizeof(ssid));
         memset(bssid, 0, sizeof(bssid));
     }
@@ -103,6 +140,7 @@ struct APInfo {
         return String(buf);
     }
 };
+static_assert(sizeof(APInfo) == 41, "[MEM] APInfo must stay padding-free (copied per cache read).");
 
 // System State
 struct SystemState {
@@ -9,15 +9,21 @@
 #include "hardware.h"
 #include "attacks.h"
 #include "web_interface.h"
-#include <esp_task_wdt.h>
+#include "survey.h"
+#include "bus.h"
+#include "benchmark.h"
+#include "rf_timeline.h"
+#include "scan_cache.h"
+#include "health.h"
 
 // [UX] Refresh Rate Limit (20 FPS)
 #define UI_REFRESH_RATE_MS 50 
 
 // Menu Options Arrays
 
-const char* mainOpts[] = {"WIFI OPS", "BLE OPS", "RF24 OPS", "EVIL TWIN", "DEFENSE", "TEST SUITE"};
-const int mainOptsCount = 6;
+const char* mainOpts[] = {"WIFI OPS", "BLE OPS", "RF24 OPS", "EVIL TWIN", "DEFENSE", "C2 DASHBOARD", "TEST SUITE"};
+const int mainOptsCount = 7;
+const int MAIN_C2_INDEX = 5;
 
 const char* wifiOpts[] = {"SCAN TARGETS", "DEAUTH TGT", "BEACON FLOOD", "PROBE SNIFF", "BACK"};
 const int wifiOptsCount = 5;
@@ -25,29 +31,29 @@ const int wifiOptsCount = 5;
 const char* bleOpts[] = {"APPLE SOUR", "SAMSUNG", "WINDOWS", "GOOGLE", "BACK"};
 const int bleOptsCount = 5;
 
-const char* rf24Opts[] = {"SPECTRUM", "JAMMER", "CARRIER DETECT", "BACK"};
-const int rf24OptsCount = 4;
+const char* rf24Opts[] = {"SPECTRUM", "JAMMER", "CARRIER DETECT", "CORRELATE", "BACK"};
+const int rf24OptsCount = 5;
 
 const char* evilTwinOpts[] = {"START", "STOP", "VIEW CREDS", "BACK"};
 const int evilTwinOptsCount = 4;
 
-const char* defenseOpts[] = {"DEAUTH DETECT", "LOGS", "BACK"};
-const int defenseOptsCount = 3;
+const char* defenseOpts[] = {"DEAUTH DETECT", "SITE SURVEY", "BLE FLOOD", "LOGS", "BACK"};
+const int defenseOptsCount = 5;
 
 
-const char* testOpts[] = {"SHOW HEAP", "FORCE WDT", "FILL NVS", "HW CHECK", "BACK"};
-const int testOptsCount = 5;
+const char* testOpts[] = {"SHOW HEAP", "FORCE WDT", "FILL NVS", "HW CHECK", "BENCHMARK", "HEALTH", "BACK"};
+const int testOptsCount = 7;
 
 UI& UI::getInstance() {
     static UI instance;
     return instance;
 }
 
-UI::UI() : scanCount(0) {
+UI::UI() : scanGen(0), scanCount(0), scanPending(false), credView(false), dashboardUp(false), bannerUntil(0) {
     state.menuLvl = 0;
     state.cursor = 0;
-    memset(scanResults, 0, sizeof(scanResults));
     memset(rfSpectrum, 0, sizeof(rfSpectrum)); 
+    memset(bannerText, 0, sizeof(bannerText));
 }
 
 void UI::init() {
@@ -63,6 +69,8 @@ void UI::init() {
     disp.display();
     delay(1500);
 
+    showResetReport();
+
     const char* disclaimer[] = {
         "User assumes ALL risk", 
         "L'utente si assume",
@@ -107,12 +115,48 @@ void UI::init() {
     disp.display();
 }
 
+void UI::requestAttack(AttackType type) {
+    MessageBus::getInstance().post(Subsystem::ENGINE, Command(CommandId::SET_ATTACK, (uint8_t)type), pdMS_TO_TICKS(BUS_POST_WAIT_MS));
+}
+
+void UI::processEvents() {
+    Command evt;
+    while (MessageBus::getInstance().receive(Subsystem::UI, evt, 0)) {
+        if (evt.id == CommandId::SCAN_DONE) {
+            scanPending = false;
+            if (!credView) syncScanList();
+        }
+        else if (evt.id == CommandId::ALERT) {
+            safeStrCopy(bannerText, evt.text, sizeof(bannerText));
+            bannerUntil = millis() + ALERT_BANNER_MS;
+        }
+        MessageBus::getInstance().markHandled(Subsystem::UI, evt);
+    }
+}
+
+// Pin the list to the newest sweep (another subsystem may have rescanned)
+void UI::syncScanList() {
+    auto& cache = ScanCache::getInstance();
+    scanGen = cache.generation();
+    scanCount = cache.count();
+    if (state.menuLvl == 10) state.cursor = 0;
+}
+
+void UI::closeCredView() {
+    if (!credView) return;
+    std::vector<StoredCred>().swap(credList);
+    credView = false;
+    scanCount = 0;
+}
+
 void UI::update() {
     // [UX] Frame Rate Limiting
     static unsigned long lastUpdate = 0;
     if (millis() - lastUpdate < UI_REFRESH_RATE_MS) return;
     lastUpdate = millis();
 
+    processEvents();
+
     int key = Hardware::getInstance().getKey();
     if(key != 0) handleInput(key);
     
@@ -132,6 +176,19 @@ void UI::update() {
 
     Hardware::getInstance().drawHeader(headerBuf, active);
 
+    // Alert banner: inverted header bar (redrawn each frame, so it simply expires)
+    if (bannerUntil != 0) {
+        if ((int32_t)(millis() - bannerUntil) < 0) {
+            disp.fillRect(0, 0, 128, 8, WHITE);
+            disp.setTextColor(BLACK);
+            disp.setCursor(1, 0);
+            disp.print(bannerText);
+            disp.setTextColor(WHITE);
+        } else {
+            bannerUntil = 0;
+        }
+    }
+
     // Spectrum Visualizer Override
     if (state.currentAttack == AttackType::RF_SCAN) {
         Hardware::getInstance().scanSpectrum(rfSpectrum);
@@ -139,6 +196,15 @@ void UI::update() {
             if(rfSpectrum[i] > 0) disp.drawLine(i, 32, i, 32-rfSpectrum[i], WHITE);
         }
     } 
+    else if (state.currentAttack == AttackType::SITE_SURVEY) {
+        renderSurvey();
+    }
+    else if (state.currentAttack == AttackType::BLE_DETECT) {
+        renderBleGuard();
+    }
+    else if (state.currentAttack == AttackType::RF_CORRELATE) {
+        renderTimeline();
+    }
     else {
         switch(state.menuLvl) {
             case 0: renderMainMenu(); break;
@@ -184,7 +250,8 @@ void UI::renderMainMenu() {
         if(idx == state.cursor) disp.print(">");
         else disp.print(" ");
         
-        disp.print(mainOpts[idx]);
+        if (idx == MAIN_C2_INDEX && dashboardUp) disp.print("C2 DASHBOARD [ON]");
+        else disp.print(mainOpts[idx]);
     }
     drawScrollbar(mainOptsCount, state.cursor);
 }
@@ -300,8 +367,99 @@ void UI::renderTestMenu() {
     drawScrollbar(testOptsCount, state.cursor);
 }
 
+void UI::renderSurvey() {
+    auto& disp = Hardware::getInstance().getDisplay();
+    auto& survey = SiteSurvey::getInstance();
+
+    char buf[24];
+    snprintf(buf, sizeof(buf), "APs:%u  N:%lu", (unsigned)survey.count(), (unsigned long)survey.getTotalSamples());
+    disp.setCursor(0, 9);
+    disp.print(buf);
+
+    // Strongest AP by median (p50) and its spread
+    SurveyRecord r;
+    SurveyRecord best;
+    bool found = false;
+    for (size_t i = 0; i < survey.count(); i++) {
+        if (!survey.getRecord(i, r)) break;
+        if (!found || r.percentile(50) > best.percentile(50)) {
+            best = r;
+            found = true;
+        }
+    }
+    if (found) {
+        snprintf(buf, sizeof(buf), "%-12.12s", best.ssid);
+        disp.setCursor(0, 17); disp.print(buf);
+        snprintf(buf, sizeof(buf), "%d/%d/%d", best.rssiMin, best.percentile(50), best.rssiMax);
+        disp.setCursor(0, 25); disp.print(buf);
+    }
+}
+
+void UI::renderBleGuard() {
+    auto& disp = Hardware::getInstance().getDisplay();
+    EngineStatus st;
+    if (!AttackEngine::getInstance().getStatus(st)) return;
+
+    char buf[24];
+    snprintf(buf, sizeof(buf), "ADV:%lu FL:%lu", (unsigned long)st.bleAdverts, (unsigned long)st.bleFloods);
+    disp.setCursor(0, 9);
+    disp.print(buf);
+
+    // Busiest vendor pattern: rate / distinct addresses / new addresses
+    if (st.bleTop.key != 0) {
+        snprintf(buf, sizeof(buf), "%-9s %04X %s", BleFloodGuard::vendorName(st.bleTop.vendor, st.bleTop.flags),
+                 (unsigned)st.bleTop.vendor, st.bleTop.flooded ? "FLOOD" : "");
+        disp.setCursor(0, 17); disp.print(buf);
+        snprintf(buf, sizeof(buf), "R%u A%u N%u %ddBm", (unsigned)st.bleTop.rate,
+                 (unsigned)st.bleTop.addresses(), (unsigned)st.bleTop.churn(), (int)st.bleTop.rssi);
+        disp.setCursor(0, 25); disp.print(buf);
+    }
+}
+
+void UI::renderTimeline() {
+    auto& disp = Hardware::getInstance().getDisplay();
+    RfSlot s;
+    if (!RfTimeline::getInstance().getLatest(s)) {
+        disp.setCursor(0, 15); disp.print("SAMPLING...");
+        return;
+    }
+
+    // Headline: strongest interference, else busiest WiFi channel
+    int worst = -1;
+    for (int k = 0; k < RF_WIFI_CHANNELS; k++) {
+        if (s.ch[k].verdict != RF_NON_WIFI) continue;
+        if (worst < 0 || s.ch[k].energy > s.ch[worst].energy) worst = k;
+    }
+    if (worst < 0) {
+        for (int k = 0; k < RF_WIFI_CHANNELS; k++) {
+            if (worst < 0 || s.ch[k].fps() > s.ch[worst].fps()) worst = k;
+        }
+    }
+    char buf[24];
+    const RfChannelSample& c = s.ch[worst];
+    if (c.verdict == RF_NON_WIFI) snprintf(buf, sizeof(buf), "CH%d NON-WIFI %u%%", worst + 1, (unsigned)c.energy);
+    else snprintf(buf, sizeof(buf), "CH%d WIFI %uf/s %u%%", worst + 1, (unsigned)c.fps(), (unsigned)c.energy);
+    disp.setCursor(0, 9);
+    disp.print(buf);
+
+    // Per channel: energy bar (left) and WiFi frame-rate bar (right), 14 px tall
+    for (int k = 0; k < RF_WIFI_CHANNELS; k++) {
+        int x = 3 + k * 9;
+        int e = s.ch[k].energy * 14 / 100;
+        uint16_t fps = s.ch[k].fps();
+        int f = (fps >= 2 * RF_WIFI_BUSY_FPS) ? 14 : fps * 14 / (2 * RF_WIFI_BUSY_FPS);
+        if (e > 0) disp.fillRect(x, 32 - e, 3, e, WHITE);
+        if (f > 0) disp.drawRect(x + 4, 32 - f, 3, f, WHITE);
+        if (s.ch[k].verdict == RF_NON_WIFI) disp.drawPixel(x + 3, 17, WHITE);
+    }
+}
+
 void UI::renderScanList() {
     auto& disp = Hardware::getInstance().getDisplay();
+    if(scanPending) {
+        disp.setCursor(0,15); disp.print("SCANNING...");
+        return;
+    }
     if(scanCount == 0) {
         disp.setCursor(0,15); disp.print("NO TARGETS FOUND");
         return;
@@ -314,7 +472,16 @@ void UI::renderScanList() {
         int idx = startIdx + i;
         if(idx >= (int)scanCount) break;
         
-        APInfo& ap = scanResults[idx];
+        const char* label;
+        APInfo ap;
+        if (credView) {
+            label = credList[idx].data;
+        } else if (ScanCache::getInstance().get(scanGen, idx, ap)) {
+            label = ap.ssid;
+        } else {
+            syncScanList();   // Replaced by a newer sweep: redraw next frame
+            break;
+        }
         
         int yPos = 9 + (i * 8);
         disp.setCursor(0, yPos);
@@ -323,24 +490,157 @@ void UI::renderScanList() {
         else disp.print(" ");
         
         char ssidBuf[16];
-        snprintf(ssidBuf, sizeof(ssidBuf), "%-14.14s", ap.ssid);
+        snprintf(ssidBuf, sizeof(ssidBuf), "%-14.14s", label);
         disp.print(ssidBuf);
         
         // Draw RSSI right-aligned
-        disp.setCursor(100, yPos);
-        disp.print(ap.rssi);
+        if (!credView) {
+            disp.setCursor(100, yPos);
+            disp.print(ap.rssi);
+        }
     }
     drawScrollbar((int)scanCount, state.cursor);
 }
 
+static void benchProgress(const char* caseName) {
+    auto& disp = Hardware::getInstance().getDisplay();
+    char buf[24];
+    snprintf(buf, sizeof(buf), "BENCH: %s...", caseName);
+    disp.clearDisplay();
+    Hardware::getInstance().drawHeader(buf, true);
+    disp.display();
+}
+
+// Runs the suite, then pages through min/median/p99 (A/D = next page, B = exit)
+void UI::runBenchmark() {
+    Benchmark::getInstance().runAll(benchProgress);
+
+    BenchReport report;
+    if (!Benchmark::getInstance().getReport(report)) return;
+
+    auto& disp = Hardware::getInstance().getDisplay();
+    const int pages = (BENCH_CASES + 2) / 3;
+    int page = 0;
+    while (true) {
+        char buf[32];
+        disp.clearDisplay();
+        snprintf(buf, sizeof(buf), "MIN/MED/P99 %d/%d", page + 1, pages);
+        Hardware::getInstance().drawHeader(buf, false);
+        for (int i = 0; i < 3; i++) {
+            int c = page * 3 + i;
+            if (c >= BENCH_CASES) break;
+            const BenchResult& r = report.results[c];
+            char mn[10], md[10], p99[10];
+            Benchmark::formatDuration(r.minNs, mn, sizeof(mn));
+            Benchmark::formatDuration(r.medianNs, md, sizeof(md));
+            Benchmark::formatDuration(r.p99Ns, p99, sizeof(p99));
+            snprintf(buf, sizeof(buf), "%-4s %-4s %-4s %s", Benchmark::caseName(c), mn, md, p99);
+            disp.setCursor(0, 9 + i * 8);
+            disp.print(buf);
+        }
+        disp.display();
+
+        int key = 0;
+        while ((key = Hardware::getInstance().getKey()) == 0) {
+            HealthMonitor::getInstance().feed(HEALTH_UI);
+            delay(50);
+        }
+        if (key == 2) break;
+        page = (page + 1) % pages;
+    }
+}
+
+// Three lines for one boot's counters (worst loop gaps in ms)
+static void printHealthBoot(const HealthBoot& b) {
+    auto& disp = Hardware::getInstance().getDisplay();
+    char buf[24];
+    snprintf(buf, sizeof(buf), "UP %lus HEAP %lu", (unsigned long)b.uptimeS, (unsigned long)b.minFreeHeap);
+    disp.setCursor(0, 9); disp.print(buf);
+    snprintf(buf, sizeof(buf), "UI%lu EN%lu NT%lums", (unsigned long)(b.worstUs(HEALTH_UI) / 1000),
+             (unsigned long)(b.worstUs(HEALTH_ENGINE) / 1000), (unsigned long)(b.worstUs(HEALTH_NET) / 1000));
+    disp.setCursor(0, 17); disp.print(buf);
+    snprintf(buf, sizeof(buf), "BUS DROPS %lu", (unsigned long)b.busDropped);
+    disp.setCursor(0, 25); disp.print(buf);
+}
+
+static void printCrash(const CrashSummary& c, int y) {
+    auto& disp = Hardware::getInstance().getDisplay();
+    char buf[24];
+    snprintf(buf, sizeof(buf), "%-.15s", c.task);
+    disp.setCursor(0, y); disp.print(buf);
+    snprintf(buf, sizeof(buf), "%.21s", HealthMonitor::causeName(c.cause));
+    disp.setCursor(0, y + 8); disp.print(buf);
+    snprintf(buf, sizeof(buf), "PC %08lX", (unsigned long)c.pc);
+    disp.setCursor(0, y + 16); disp.print(buf);
+}
+
+// After a WDT / panic / brownout: what happened, before the disclaimer
+void UI::showResetReport() {
+    auto& health = HealthMonitor::getInstance();
+    if (!health.abnormalReset()) return;
+
+    auto& disp = Hardware::getInstance().getDisplay();
+    char buf[24];
+    disp.clearDisplay();
+    snprintf(buf, sizeof(buf), "RESET: %s", HealthMonitor::resetName(health.resetReason()));
+    Hardware::getInstance().drawHeader(buf, true);
+    if (health.crash().fresh) printCrash(health.crash(), 9);
+    else printHealthBoot(health.previous());
+    disp.display();
+    delay(HEALTH_BOOT_SCREEN_MS);
+}
+
+// Counters / this boot / previous boot / coredump (A/D = next page, B = exit)
+void UI::runHealth() {
+    auto& health = HealthMonitor::getInstance();
+    auto& disp = Hardware::getInstance().getDisplay();
+    const int pages = 4;
+    int page = 0;
+    while (true) {
+        char buf[32];
+        const HealthCounters& c = health.counters();
+        disp.clearDisplay();
+        if (page == 0) {
+            snprintf(buf, sizeof(buf), "HEALTH %d/%d", page + 1, pages);
+            Hardware::getInstance().drawHeader(buf, false);
+            snprintf(buf, sizeof(buf), "RST %s B%lu", HealthMonitor::resetName(health.resetReason()), (unsigned long)c.boots);
+            disp.setCursor(0, 9); disp.print(buf);
+            snprintf(buf, sizeof(buf), "WDT%lu PAN%lu BRN%lu", (unsigned long)c.wdtResets, (unsigned long)c.panics,
+                     (unsigned long)c.brownouts);
+            disp.setCursor(0, 17); disp.print(buf);
+            snprintf(buf, sizeof(buf), "DROPS TOTAL %lu", (unsigned long)c.dropsTotal);
+            disp.setCursor(0, 25); disp.print(buf);
+        } else if (page == 1 || page == 2) {
+            snprintf(buf, sizeof(buf), "%s BOOT %d/%d", (page == 1) ? "THIS" : "PREV", page + 1, pages);
+            Hardware::getInstance().drawHeader(buf, false);
+            printHealthBoot((page == 1) ? c.current : health.previous());
+        } else {
+            snprintf(buf, sizeof(buf), "COREDUMP %d/%d", page + 1, pages);
+            Hardware::getInstance().drawHeader(buf, false);
+            if (health.crash().present) printCrash(health.crash(), 9);
+            else { disp.setCursor(0, 15); disp.print("NONE"); }
+        }
+        disp.display();
+
+        int key = 0;
+        while ((key = Hardware::getInstance().getKey()) == 0) {
+            HealthMonitor::getInstance().feed(HEALTH_UI);
+            delay(50);
+        }
+        if (key == 2) break;
+        page = (page + 1) % pages;
+    }
+}
+
 void UI::handleInput(int key) {
     // 1=A(Sel), 2=B(Back), 3=C(Up), 4=D(Down)
     
     if(key == 2) { // Back / Stop
         if(AttackEngine::getInstance().isAttacking()) {
-            AttackEngine::getInstance().stopAttack();
+            MessageBus::getInstance().post(Subsystem::ENGINE, Command(CommandId::STOP_ATTACK), pdMS_TO_TICKS(BUS_POST_WAIT_MS));
             state.currentAttack = AttackType::NONE;
         } else if(state.menuLvl > 0) {
+            closeCredView();
             state.menuLvl = 0;
             state.cursor = 0;
         }
@@ -376,83 +676,86 @@ void UI::executeAction(int index) {
         else if(index == 2) { state.menuLvl = 3; state.cursor = 0; }
         else if(index == 3) { state.menuLvl = 4; state.cursor = 0; }
         else if(index == 4) { state.menuLvl = 5; state.cursor = 0; }
-        else if(index == 5) { state.menuLvl = 6; state.cursor = 0; } 
+        else if(index == MAIN_C2_INDEX) {
+            // Toggle the C2 AP (LEVIATHAN_NET) serving the dashboard at 192.168.4.1
+            Command web(dashboardUp ? CommandId::WEB_STOP : CommandId::WEB_START, 0);
+            if (MessageBus::getInstance().post(Subsystem::WEB, web, pdMS_TO_TICKS(BUS_POST_WAIT_MS))) dashboardUp = !dashboardUp;
+        }
+        else if(index == 6) { state.menuLvl = 6; state.cursor = 0; } 
     }
     else if(state.menuLvl == 1) { 
         if(index == 0) { 
-            Hardware::getInstance().drawHeader("SCANNING...", true);
-            Hardware::getInstance().getDisplay().display();
-            
-            scanCount = AttackEngine::getInstance().scanNetworks(scanResults, MAX_SCAN_RESULTS);
-            
-            if(scanCount == 0) {
-            }
+            // Sweep runs in AttackCore; SCAN_DONE lands in our queue
+            Command scan(CommandId::SCAN);
+            scan.replyTo = Subsystem::UI;
+            scanPending = MessageBus::getInstance().post(Subsystem::ENGINE, scan, pdMS_TO_TICKS(BUS_POST_WAIT_MS));
+            closeCredView();
+            scanCount = 0;
             
             state.menuLvl = 10; 
             state.cursor = 0;
         }
         else if(index == 1) { 
-             AttackEngine::getInstance().setAttack(AttackType::DEAUTH_TARGET);
+             requestAttack(AttackType::DEAUTH_TARGET);
         }
         else if(index == 2) { 
-             AttackEngine::getInstance().setAttack(AttackType::BEACON_RANDOM);
+             requestAttack(AttackType::BEACON_RANDOM);
         }
         else if(index == 3) { 
-             AttackEngine::getInstance().setAttack(AttackType::PROBE_SNIFF);
+             requestAttack(AttackType::PROBE_SNIFF);
         }
     }
     else if(state.menuLvl == 2) { 
         if(index == 0) {
             state.currentAttack = AttackType::BLE_SOUR;
-            AttackEngine::getInstance().setAttack(AttackType::BLE_SOUR);
+            requestAttack(AttackType::BLE_SOUR);
         }
         else if(index == 1) {
             state.currentAttack = AttackType::BLE_SAMS;
-            AttackEngine::getInstance().setAttack(AttackType::BLE_SAMS);
+            requestAttack(AttackType::BLE_SAMS);
         }
         else if(index == 2) {
             state.currentAttack = AttackType::BLE_WIN;
-            AttackEngine::getInstance().setAttack(AttackType::BLE_WIN);
+            requestAttack(AttackType::BLE_WIN);
         }
         else if(index == 3) {
             state.currentAttack = AttackType::BLE_GOOGLE;
-            AttackEngine::getInstance().setAttack(AttackType::BLE_GOOGLE);
+            requestAttack(AttackType::BLE_GOOGLE);
         }
     }
     else if(state.menuLvl == 3) { 
         if(index == 0) {
             state.currentAttack = AttackType::RF_SCAN;
-            AttackEngine::getInstance().setAttack(AttackType::RF_SCAN);
+            requestAttack(AttackType::RF_SCAN);
         }
         else if(index == 1) {
             state.currentAttack = AttackType::RF_JAM;
-            AttackEngine::getInstance().setAttack(AttackType::RF_JAM);
+            requestAttack(AttackType::RF_JAM);
         }
         else if(index == 2) {
             Hardware::getInstance().scanSpectrum(rfSpectrum);
         }
+        else if(index == 3) {
+            state.currentAttack = AttackType::RF_CORRELATE;
+            requestAttack(AttackType::RF_CORRELATE);
+        }
     }
     else if(state.menuLvl == 4) { 
         if(index == 0) {
-            WebInterface::getInstance().start(true);
+            MessageBus::getInstance().post(Subsystem::WEB, Command(CommandId::WEB_START, 1), pdMS_TO_TICKS(BUS_POST_WAIT_MS));
+            dashboardUp = false;   // Same server: the portal replaces the dashboard
             state.currentAttack = AttackType::EVIL_TWIN;
-            AttackEngine::getInstance().setAttack(AttackType::EVIL_TWIN);
+            requestAttack(AttackType::EVIL_TWIN);
         }
         else if(index == 1) {
-            WebInterface::getInstance().stop();
-            AttackEngine::getInstance().stopAttack();
+            MessageBus::getInstance().post(Subsystem::WEB, Command(CommandId::WEB_STOP), pdMS_TO_TICKS(BUS_POST_WAIT_MS));
+            MessageBus::getInstance().post(Subsystem::ENGINE, Command(CommandId::STOP_ATTACK), pdMS_TO_TICKS(BUS_POST_WAIT_MS));
             state.currentAttack = AttackType::NONE;
         }
         else if(index == 2) {
-            auto creds = Hardware::getInstance().loadCreds();
-            if(creds.empty()) {
-                scanCount = 0;
-            } else {
-                scanCount = creds.size();
-                for(size_t i=0; i<creds.size() && i<MAX_SCAN_RESULTS; i++) {
-                    safeStrCopy(scanResults[i].ssid, creds[i].data, sizeof(scanResults[i].ssid));
-                }
-            }
+            credList = Hardware::getInstance().loadCreds();
+            credView = true;
+            scanCount = credList.size();
             state.menuLvl = 10;
             state.cursor = 0;
         }
@@ -460,16 +763,38 @@ void UI::executeAction(int index) {
     else if(state.menuLvl == 5) { 
         if(index == 0) {
             state.currentAttack = AttackType::DEAUTH_DETECT;
-            AttackEngine::getInstance().setAttack(AttackType::DEAUTH_DETECT);
+            requestAttack(AttackType::DEAUTH_DETECT);
         }
         else if(index == 1) {
-            int deauthCount = AttackEngine::getInstance().getDeauthCount();
+            state.currentAttack = AttackType::SITE_SURVEY;
+            requestAttack(AttackType::SITE_SURVEY);
+        }
+        else if(index == 2) {
+            state.currentAttack = AttackType::BLE_DETECT;
+            requestAttack(AttackType::BLE_DETECT);
+        }
+        else if(index == 3) {
+            auto& engine = AttackEngine::getInstance();
             char logBuf[32];
-            snprintf(logBuf, sizeof(logBuf), "DEAUTH: %d", deauthCount);
             auto& disp = Hardware::getInstance().getDisplay();
             disp.clearDisplay();
+            snprintf(logBuf, sizeof(logBuf), "DEAUTH: %d", engine.getDeauthCount());
+            disp.setCursor(0, 0);
+            disp.print(logBuf);
+            snprintf(logBuf, sizeof(logBuf), "SPOOFED: %lu", (unsigned long)engine.getSpoofCount());
             disp.setCursor(0, 10);
             disp.print(logBuf);
+
+            // Most recent alert; deauth guard lines drop their "SPOOF " tag (kind + BSSID fit one row)
+            AttackLog last;
+            if (engine.getLastAlert(last)) {
+                static const char SPOOF_TAG[] = "SPOOF ";
+                const char* line = last.data;
+                if (strncmp(line, SPOOF_TAG, strlen(SPOOF_TAG)) == 0) line += strlen(SPOOF_TAG);
+                snprintf(logBuf, sizeof(logBuf), "%.21s", line);
+                disp.setCursor(0, 20);
+                disp.print(logBuf);
+            }
             disp.display();
             delay(2000);
         }
@@ -486,11 +811,29 @@ void UI::executeAction(int index) {
         else if(index == 2) {
             Hardware::getInstance().drawHeader("FILLING NVS...", true);
             Hardware::getInstance().getDisplay().display();
-            for(int i=0; i<60; i++) { 
-                char junk[32];
-                snprintf(junk, 32, "TEST_USER_%d:PASS", i);
-                Hardware::getInstance().saveCred(junk);
-                delay(10);
+            // Goes through StorageCore (sole NVS writer). Each post waits for queue room,
+            // bounded well below the 5 s watchdog: a post that still times out is a drop.
+            const int total = 60;
+            int accepted = 0;
+            for(int i=0; i<total; i++) { 
+                Command save(CommandId::SAVE_CRED);
+                snprintf(save.text, sizeof(save.text), "TEST_USER_%d:PASS", i);
+                if (MessageBus::getInstance().post(Subsystem::STORAGE, save, pdMS_TO_TICKS(1000))) accepted++;
+                HealthMonitor::getInstance().feed(HEALTH_UI);
+            }
+            if (ENABLE_SERIAL_LOG) Serial.printf("[TEST] NVS fill: %d accepted, %d dropped\n", accepted, total - accepted);
+
+            auto& disp = Hardware::getInstance().getDisplay();
+            disp.clearDisplay();
+            disp.setCursor(0, 0); disp.print("NVS FILL:");
+            disp.drawFastHLine(0, 8, 128, WHITE);
+            disp.setCursor(0, 12); disp.print("ACCEPTED: "); disp.print(accepted);
+            disp.setCursor(0, 22); disp.print("DROPPED:  "); disp.print(total - accepted);
+            disp.display();
+
+            while(Hardware::getInstance().getKey() == 0) { 
+                HealthMonitor::getInstance().feed(HEALTH_UI); 
+                delay(50); 
             }
         }
         else if(index == 3) {
@@ -509,15 +852,27 @@ void UI::executeAction(int index) {
             disp.display();
             
             while(Hardware::getInstance().getKey() == 0) { 
-                esp_task_wdt_reset(); 
+                HealthMonitor::getInstance().feed(HEALTH_UI); 
                 delay(50); 
             }
         }
+        else if(index == 4) {
+            runBenchmark();
+        }
+        else if(index == 5) {
+            runHealth();
+        }
     }
     else if(state.menuLvl == 10) { 
-        if(scanCount > 0) {
-            APInfo& target = scanResults[index];
-            AttackEngine::getInstance().setTarget(target.bssid, target.ch);
+        APInfo target;
+        if(credView) return;   // Read-only list
+        if(!ScanCache::getInstance().get(scanGen, index, target)) {
+            syncScanList();    // Sweep replaced under the cursor: never target the wrong AP
+        } else {
+            Command cmd(CommandId::SET_TARGET);
+            memcpy(cmd.bssid, target.bssid, 6);
+            cmd.channel = (int16_t)target.ch;
+            MessageBus::getInstance().post(Subsystem::ENGINE, cmd, pdMS_TO_TICKS(BUS_POST_WAIT_MS));
             state.menuLvl = 1;
             state.cursor = 1;
         }
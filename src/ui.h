@@ -8,6 +8,7 @@
 #pragma once
 #include "types.h"
 #include "config.h"
+#include <vector>
 
 class UI {
 public:
@@ -24,10 +25,23 @@ private:
     SystemState state;
     
   
-    APInfo scanResults[MAX_SCAN_RESULTS];
+    // Scan list rows are read from ScanCache on demand, pinned to one generation
+    uint32_t scanGen;
     size_t scanCount; 
+    bool scanPending;
+
+    // VIEW CREDS reuses the list screen; loaded on entry, released on exit
+    std::vector<StoredCred> credList;
+    bool credView;
+
+    // C2 dashboard AP started from the main menu
+    bool dashboardUp;
 
     uint8_t rfSpectrum[128];
+
+    // Alert banner (CommandId::ALERT from the AlertEngine), replaces the header line
+    char bannerText[22];
+    uint32_t bannerUntil;
     
     // Menus
     void renderMainMenu();
@@ -38,8 +52,18 @@ private:
     void renderDefenseMenu();
     void renderScanList();
     void renderTestMenu();
+    void renderSurvey();
+    void renderBleGuard();
+    void renderTimeline();
     
     // Actions
     void handleInput(int key);
     void executeAction(int index);
+    void requestAttack(AttackType type);
+    void processEvents();
+    void syncScanList();
+    void closeCredView();
+    void runBenchmark();
+    void runHealth();
+    void showResetReport();
 };
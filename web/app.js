@@ -0,0 +1,155 @@
+// Leviathan C2 dashboard. Polls the JSON API incrementally; every string from the
+// air (SSIDs, vendors) is inserted as text, never as HTML.
+'use strict';
+
+const $ = (id) => document.getElementById(id);
+const POLL = { status: 2000, timeline: 2000, alerts: 1000, events: 5000, survey: 10000 };
+const COLORS = { quiet: '#2f3b44', wifi: '#29d398', nonwifi: '#ff4d4f' };
+
+function el(tag, text, cls) {
+  const e = document.createElement(tag);
+  if (text !== undefined) e.textContent = text;
+  if (cls) e.className = cls;
+  return e;
+}
+
+async function getJson(url) {
+  const r = await fetch(url, { cache: 'no-store' });
+  if (!r.ok) throw new Error(url + ' ' + r.status);
+  return r.json();
+}
+
+function every(ms, fn) {
+  const run = () => fn().catch(() => {}).finally(() => setTimeout(run, ms));
+  run();
+}
+
+function age(ms) {
+  if (ms < 1000) return ms + 'ms';
+  if (ms < 60000) return Math.round(ms / 1000) + 's';
+  if (ms < 3600000) return Math.round(ms / 60000) + 'm';
+  return Math.round(ms / 3600000) + 'h';
+}
+
+// --- STATUS ---
+async function pollStatus() {
+  const s = await getJson('/api/status');
+  $('mode').textContent = s.mode + (s.active ? ' (ACTIVE)' : '');
+  const rows = [
+    ['Deauth frames', s.deauth], ['Spoofed', s.spoofed], ['Sniffer calls', s.sniffer],
+    ['Handshakes', s.handshakes], ['Probes', s.probes], ['Alerts', s.alerts],
+    ['BLE adverts', s.ble.adverts], ['BLE floods', s.ble.flooded],
+    ['BLE top', s.ble.top.vendor ? s.ble.top.vendor + ' r' + s.ble.top.rate + ' a' + s.ble.top.addrs : '-'],
+    ['Free heap', s.heap + ' B'],
+  ];
+  const dl = $('status');
+  dl.replaceChildren();
+  for (const [k, v] of rows) { dl.append(el('dt', k), el('dd', String(v))); }
+}
+
+// --- SPECTRUM (latest timeline slot) ---
+let timelineGen = 0;
+async function pollTimeline() {
+  const t = await getJson('/api/timeline?since=' + timelineGen);
+  timelineGen = t.gen;
+  if (!t.slots.length) return;
+  const slot = t.slots[t.slots.length - 1];
+  drawSpectrum(slot);
+  $('slot-info').textContent = 'slot ' + t.gen + ', ' + slot.sweeps + ' sweeps, ' + age(t.now - slot.t) + ' ago';
+}
+
+function drawSpectrum(slot) {
+  const c = $('spectrum');
+  const g = c.getContext('2d');
+  const w = c.width / slot.ch.length;
+  const maxFps = Math.max(50, ...slot.ch.map((x) => x[2]));
+  g.clearRect(0, 0, c.width, c.height);
+  g.font = '11px monospace';
+  slot.ch.forEach(([frames, dwell, fps, energy, verdict], i) => {
+    const x = i * w;
+    const hE = (energy / 100) * (c.height - 20);
+    g.fillStyle = COLORS[verdict] || COLORS.quiet;
+    g.fillRect(x + 4, c.height - 16 - hE, w - 8, hE);
+    const hF = (fps / maxFps) * (c.height - 20);
+    g.fillStyle = '#d7e0e6';
+    g.fillRect(x + w / 2 - 1, c.height - 16 - hF, 2, hF);
+    g.fillStyle = '#7c8a94';
+    g.fillText(String(i + 1), x + w / 2 - 4, c.height - 3);
+  });
+}
+
+// --- ALERTS (event log, incremental) ---
+const ALERT_KINDS = {
+  deauth_spoof: (e) => 'Deauth spoof (' + e.why + ') ' + e.bssid + ' ' + e.rssi + ' dBm',
+  ble_flood: (e) => 'BLE flood ' + e.vendor + ' rate ' + e.rate + ' addrs ' + e.addrs,
+  rf_interference: (e) => e.mask ? 'RF interference ch ' + channels(e.mask) + ' (' + e.peak + '%)' : 'RF interference cleared',
+  boot: (e) => 'Boot (reset reason ' + e.reason + ')',
+  crash: (e) => 'Crash in ' + e.task + ' (mcause ' + e.cause + ') PC ' + e.pc + ' RA ' + e.ra,
+  alert: (e) => 'Alert ' + e.rule + (e.open ? ' OPEN ' + e.value : ' closed (peak ' + e.peak + ')') +
+    (e.ch ? ' ch ' + e.ch : '') + (e.bssid !== '00:00:00:00:00:00' ? ' ' + e.bssid : ''),
+};
+let eventsFrom = null;
+let edge = new Set();   // Events at the cursor ms already shown (`next` repeats that ms)
+
+function channels(mask) {
+  const out = [];
+  for (let k = 0; k < 14; k++) if (mask & (1 << k)) out.push(k + 1);
+  return out.join(',');
+}
+
+async function pollEvents() {
+  if (eventsFrom === null) {
+    const probe = await getJson('/api/events?limit=1');
+    eventsFrom = Math.max(0, probe.now - 3600000);
+  }
+  const r = await getJson('/api/events?from=' + eventsFrom);
+  const ul = $('alerts');
+  const wall = Date.now();
+  for (const e of r.events) {
+    const key = JSON.stringify(e);
+    if (e.t === eventsFrom && edge.has(key)) continue;
+    if (e.t !== eventsFrom) { edge = new Set(); eventsFrom = e.t; }
+    edge.add(key);
+    const fmt = ALERT_KINDS[e.k];
+    if (!fmt) continue;
+    const li = el('li');
+    const when = new Date(wall - (r.now - e.t)).toLocaleTimeString();
+    li.append(el('span', when, 't'), document.createTextNode(fmt(e)));
+    ul.prepend(li);
+  }
+  while (ul.children.length > 100) ul.lastChild.remove();
+}
+
+// --- INCIDENTS (alert engine, open rules in the header) ---
+let alertsSince = 0;
+async function pollAlerts() {
+  const a = await getJson('/api/alerts?since=' + alertsSince);
+  alertsSince = a.last;
+  const open = a.rules.filter((r) => r.open).map((r) => r.rule.replace('_', ' ').toUpperCase() + ' ' + r.value);
+  const pill = $('incident');
+  pill.hidden = !open.length;
+  pill.textContent = open.join(' | ');
+  pill.title = a.suppressed ? a.suppressed + ' re-openings held back by cooldown' : '';
+}
+
+// --- SURVEY ---
+async function pollSurvey() {
+  const s = await getJson('/api/survey');
+  const tb = $('survey');
+  tb.replaceChildren();
+  s.aps.sort((a, b) => b.avg - a.avg);
+  for (const ap of s.aps) {
+    const tr = el('tr');
+    for (const v of [ap.s, ap.b, ap.c, ap.last, ap.avg, ap.p10 + '/' + ap.p50 + '/' + ap.p90, ap.n, age(ap.age)]) {
+      tr.append(el('td', String(v)));
+    }
+    tb.append(tr);
+  }
+}
+
+$('stop').addEventListener('click', () => fetch('/api/stop'));
+every(POLL.status, pollStatus);
+every(POLL.timeline, pollTimeline);
+every(POLL.alerts, pollAlerts);
+every(POLL.events, pollEvents);
+every(POLL.survey, pollSurvey);